@@ -1,37 +1,2004 @@
 // dear imgui: "null" example application
-// (compile and link imgui, create context, run headless with NO INPUTS, NO GRAPHICS OUTPUT)
+// (compile and link imgui, create context, run headless with scripted inputs, NO GRAPHICS OUTPUT)
 // This is useful to test building, but you cannot interact with anything here!
+//
+// This application doubles as a headless CPU benchmark harness. It runs a set of fixed scenes for a fixed number of frames,
+// with a deterministic io.DeltaTime and scripted mouse/keyboard inputs, and reports per-phase timings along with the
+// vertex/index/command counts found in ImDrawData. The output is machine-readable (CSV or JSON) so runs can be diffed across commits.
+// - Build with optimizations for meaningful numbers, e.g. 'CXXFLAGS=-O2 make' or 'build_win32.bat /O2'.
+// - Usage: example_null [--mode frames|drawlist|fontatlas|text|check] [--scene <name>] [--frames <count>] [--warmup <count>] [--format csv|json] [--output <filename>] [--assert-no-alloc 0|1] [--flatten-draw-data 0|1] [--damage-rects 0|1] [--list-hashes 0|1] [--list]
+// - Timings are in milliseconds per frame. Counts (including heap allocations) are averaged over measured frames.
+//   Heap allocations made by the worker threads of the 'canvas_mt' scene are not counted (see MemAlloc()). Counts come from the
+//   per-frame ImGuiMemStats, not from io.MetricsActiveAllocations which drifts when those draw lists are destroyed on the main thread.
+// - '--assert-no-alloc 1' asserts on any heap allocation made after the warm-up frames, see DebugStartAllocationAssert().
+// - '--flatten-draw-data 1' sets io.ConfigDrawDataFlatten (and ImGuiBackendFlags_RendererHasVtxOffset), so ImDrawData holds a single
+//   draw list (see cmd_count and cmd_lists_count).
+// - '--damage-rects 1' sets io.ConfigDrawDataDamageRects. 'damage_pct' reports the percentage of the display covered by ImDrawData::DamageRects
+//   (always 100 without it).
+// - '--list-hashes 1' sets io.ConfigDrawDataListHashes. 'upload_pct' reports the percentage of vertex/index bytes in draw lists whose
+//   contents changed (ImDrawList::ContentChanged), which a renderer back-end keeping draw lists on the GPU uploads (always 100 without it).
+// - '--mode drawlist' instead runs ImDrawList microbenchmarks: each primitive type and ImDrawListFlags combination is
+//   submitted in batches into a standalone ImDrawList for '--bench-ms <milliseconds>' (default 200), reporting primitives/sec
+//   and vertices/sec. '--scene' then filters benchmarks by name prefix (e.g. '--scene AddCircle').
+// - '--mode fontatlas' instead rebuilds font atlases for '--bench-ms <milliseconds>': the default font, then the fonts in
+//   '--fonts-dir' (default ../../misc/fonts) with the default, ChineseFull and Japanese glyph ranges, plus '--font-file' if any.
+//   Reports build time split into glyph lookup, rect packing, rasterization and finish (the split is only reported with '#define IMGUI_DEBUG_PROFILER'),
+//   and the resulting glyph count and texture size. ImGuiFreeType::BuildFontAtlas() is also measured when building with WITH_FREETYPE=1.
+// - '--mode text' instead runs ImFont::CalcTextSizeA(), CalcWordWrapPositionA() and RenderText() (with and without wrapping
+//   and cpu_fine_clip) over 64 KB corpora: ASCII logs, mixed UTF-8, CJK, a single long line and paragraphs. Reports MB/sec and
+//   characters/sec. Glyphs of '--font-file' (e.g. a CJK font) are merged into the default font with the ChineseFull ranges.
+// - '--mode check' instead runs ImDrawList regression checks, reporting which ones passed. '--scene' then filters them by name prefix.
+//   The exit code is 1 if any check failed. Also run them in a 'CXXFLAGS=-DIMGUI_USE_COMPACT_DRAWVERT make' build, as the
+//   'Canvas/Transform/...' ones cover the range and precision of its 16-bit positions.
+// - '--record <filename>' saves the inputs of all frames of a scene (see ImGuiInputRecorder) and '--replay <filename>' runs a scene
+//   with recorded inputs instead of the scripted ones (see ImGuiInputReplay). Both report per-frame timings and a hash of ImDrawData
+//   (see DebugHashDrawData()) instead of averages, so a replay can be diffed against its recording to catch rendering changes.
+// - '--trace <filename>' writes the measured frames of '--mode frames' as Chrome trace-event JSON (see ProfilerTraceExport()), to open
+//   in chrome://tracing or Perfetto. Dear ImGui phases and windows appear next to this application's own per-frame scene events.
+//   Requires '#define IMGUI_DEBUG_PROFILER'.
+
 #include "imgui.h"
-#include <stdio.h>
+#include "imgui_internal.h" // LogToBuffer(), DebugStartAllocationAssert()
+#include <stdio.h>          // printf, fprintf, fopen
+#include <stdarg.h>         // va_list
+#include <stdlib.h>         // atoi, malloc
+#include <string.h>         // strcmp
+#include <math.h>           // sinf, cosf
+#ifdef IMGUI_ENABLE_FREETYPE
+#include "misc/freetype/imgui_freetype.h" // ImGuiFreeType::BuildFontAtlas()
+#endif
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>        // QueryPerformanceCounter, CreateThread
+#else
+#include <time.h>           // clock_gettime
+#include <pthread.h>        // pthread_create
+#endif
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
 
-int main(int, char**)
+// High resolution timer. We don't use <chrono> so this can still be built without the C++ runtime.
+static double GetTimeInSeconds()
 {
-    IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency;
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+// Minimal thread wrapper, for the same reason.
+struct BenchThread
+{
+    void            (*Func)(void* user_data);
+    void*           UserData;
+#if defined(_WIN32)
+    HANDLE          Handle;
+#else
+    pthread_t       Handle;
+#endif
+};
+
+#if defined(_WIN32)
+static DWORD WINAPI BenchThreadEntry(LPVOID arg)    { BenchThread* thread = (BenchThread*)arg; thread->Func(thread->UserData); return 0; }
+#else
+static void*        BenchThreadEntry(void* arg)     { BenchThread* thread = (BenchThread*)arg; thread->Func(thread->UserData); return NULL; }
+#endif
+
+static void BenchThreadStart(BenchThread* thread, void (*func)(void* user_data), void* user_data)
+{
+    thread->Func = func;
+    thread->UserData = user_data;
+#if defined(_WIN32)
+    thread->Handle = ::CreateThread(NULL, 0, BenchThreadEntry, thread, 0, NULL);
+    IM_ASSERT(thread->Handle != NULL);
+#else
+    int ret = pthread_create(&thread->Handle, NULL, BenchThreadEntry, thread);
+    IM_ASSERT(ret == 0);
+    IM_UNUSED(ret);
+#endif
+}
+
+static void BenchThreadJoin(BenchThread* thread)
+{
+#if defined(_WIN32)
+    ::WaitForSingleObject(thread->Handle, INFINITE);
+    ::CloseHandle(thread->Handle);
+#else
+    pthread_join(thread->Handle, NULL);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Scenes
+//-----------------------------------------------------------------------------
+
+// Demo window with all collapsing headers opened. Tree nodes are expanded by enabling logging during the frame
+// (see TreeNodeBehaviorIsOpen()), so this scene also measures the cost of the logging code path.
+static void SceneDemo(int frame)
+{
+    if (frame == 0)
+    {
+        // Collapsing headers are not auto-expanded by logging: write their open state into the window storage.
+        // Calling Begin() twice on the same window in a frame is allowed and appends to it.
+        static const char* headers[] = { "Help", "Configuration", "Window options", "Widgets", "Layout & Scrolling", "Popups & Modal windows", "Columns", "Filtering", "Inputs, Navigation & Focus" };
+        ImGui::Begin("Dear ImGui Demo");
+        for (int n = 0; n < IM_ARRAYSIZE(headers); n++)
+            ImGui::GetStateStorage()->SetInt(ImGui::GetID(headers[n]), 1);
+        ImGui::End();
+    }
+    ImGui::LogToBuffer(8);
+    ImGui::ShowDemoWindow(NULL);
+    ImGui::LogFinish();
+}
+
+// 10k rows submitted without ImGuiListClipper, so most of the cost is in ItemAdd() coarse clipping.
+static void SceneList(int frame)
+{
+    static int selected = -1;
+    ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(600, 1000), ImGuiCond_Always);
+    ImGui::Begin("10k rows");
+    ImGui::Text("Frame %d", frame);
+    ImGui::BeginChild("rows");
+    for (int n = 0; n < 10000; n++)
+    {
+        char label[32];
+        snprintf(label, IM_ARRAYSIZE(label), "Row %05d", n);
+        if (ImGui::Selectable(label, selected == n, 0, ImVec2(200, 0)))
+            selected = n;
+        ImGui::SameLine();
+        ImGui::Text("%08X", (unsigned int)(n * 2654435761u));
+    }
+    ImGui::EndChild();
+    ImGui::End();
+}
+
+// 1000 small windows laid out in a grid covering the display.
+static void SceneWindows(int frame)
+{
+    const int columns = 40;
+    for (int n = 0; n < 1000; n++)
+    {
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Window %03d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)((n % columns) * 48), (float)((n / columns) * 43)), ImGuiCond_Always);
+        ImGui::SetNextWindowSize(ImVec2(46, 41), ImGuiCond_Always);
+        ImGui::Begin(name);
+        ImGui::Text("%d", frame + n);
+        ImGui::Button("OK");
+        ImGui::End();
+    }
+}
+
+// Dense line and histogram plots.
+static void ScenePlots(int frame)
+{
+    static float values[4096];
+    for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+        values[n] = sinf((float)(n + frame) * 0.01f) + sinf((float)n * 0.37f) * 0.25f;
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080), ImGuiCond_Always);
+    ImGui::Begin("Plots");
+    for (int n = 0; n < 4; n++)
+    {
+        ImGui::PushID(n);
+        ImGui::PlotLines("##lines", values + n * 16, IM_ARRAYSIZE(values) - n * 16, 0, NULL, -1.5f, 1.5f, ImVec2(1800, 150));
+        ImGui::PopID();
+    }
+    for (int n = 0; n < 2; n++)
+    {
+        ImGui::PushID(n);
+        ImGui::PlotHistogram("##histogram", values + n * 512, 512, 0, NULL, -1.5f, 1.5f, ImVec2(1800, 150));
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// 40 dashboard windows whose data only changes every 60 frames, submitted every frame or cached while idle (see ImGuiWindowFlags_CacheContents).
+static void SceneDashboard(int frame, bool cached)
+{
+    const int data_version = frame / 60;
+    float values[128];
+    for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+        values[n] = sinf((float)(n + data_version) * 0.1f) + sinf((float)n * 0.37f) * 0.25f;
+
+    const int columns = 8;
+    for (int n = 0; n < 40; n++)
+    {
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Dashboard %02d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)((n % columns) * 240), (float)((n / columns) * 216)), ImGuiCond_Always);
+        ImGui::SetNextWindowSize(ImVec2(236, 212), ImGuiCond_Always);
+        if (cached)
+            ImGui::SetNextWindowContentToken((ImGuiID)data_version);
+        if (ImGui::Begin(name, NULL, cached ? ImGuiWindowFlags_CacheContents : 0))
+        {
+            ImGui::Text("Version %d, channel %d", data_version, n);
+            ImGui::PlotLines("##lines", values, IM_ARRAYSIZE(values), n, NULL, -1.5f, 1.5f, ImVec2(-1, 60));
+            ImGui::BeginChild("legend", ImVec2(0, 0), true);
+            for (int i = 0; i < 4; i++)
+                ImGui::BulletText("Series %d: %.3f", i, values[(n + i * 7) % IM_ARRAYSIZE(values)]);
+            ImGui::EndChild();
+        }
+        ImGui::End();
+    }
+}
+
+// 20 sets of 24 columns, each set splitting the window draw list into 25 channels then merging them back.
+static void SceneColumns(int frame)
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080), ImGuiCond_Always);
+    ImGui::Begin("Columns");
+    for (int set = 0; set < 20; set++)
+    {
+        ImGui::PushID(set);
+        ImGui::Columns(24, "columns");
+        for (int n = 0; n < 24 * 2; n++)
+        {
+            ImGui::Text("%04d", (frame + set * 100 + n) % 10000);
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// Operator console whose contents barely change: a log, unit statuses and a focused command line with a blinking cursor (see '--damage-rects').
+static void SceneConsole(int frame)
+{
+    static char command[256];
+    if (frame == 0)
+        command[0] = 0;
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(1280, 1080), ImGuiCond_Always);
+    ImGui::Begin("Log");
+    for (int n = 0; n < 60; n++)
+        ImGui::Text("[%05d] Unit %02d: status nominal, load %d%%", n * 17, n % 16, (n * 37) % 100);
+    ImGui::End();
+
+    ImGui::SetNextWindowPos(ImVec2(1280, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(640, 1080), ImGuiCond_Always);
+    ImGui::Begin("Console");
+    for (int n = 0; n < 16; n++)
+    {
+        ImGui::Text("Unit %02d", n);
+        ImGui::SameLine(100);
+        ImGui::ProgressBar((float)((n * 37) % 100) / 100.0f, ImVec2(-1, 0));
+    }
+    ImGui::Separator();
+    if (frame == 0)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputText("Command", command, IM_ARRAYSIZE(command));
+    ImGui::End();
+}
+
+// 8 map views whose contents (contour lines, markers and labels) are filled into standalone draw lists, then appended to their
+// window draw list with ImDrawList::AddDrawList(). Filled on the main thread, or on one worker thread per view (see "Multi-threading" above ImDrawList).
+struct CanvasView
+{
+    ImDrawList*     DrawList;
+    ImVec2          Pos;
+    ImVec2          Size;
+    ImTextureID     FontTexID;
+    int             Frame;
+};
+
+static ImDrawListSharedData*    g_CanvasSharedData = NULL;
+static CanvasView               g_CanvasViews[8];
+
+// Called from worker threads: only uses the draw list and its copy of the shared data, no ImGui:: function.
+static void CanvasViewFill(void* user_data)
+{
+    CanvasView* view = (CanvasView*)user_data;
+    ImDrawList* draw_list = view->DrawList;
+    draw_list->_ResetForNewFrame();
+    draw_list->PushTextureID(view->FontTexID);
+    draw_list->PushClipRect(view->Pos, ImVec2(view->Pos.x + view->Size.x, view->Pos.y + view->Size.y));
+
+    const float t = (float)view->Frame * 0.02f;
+    ImVec2 points[256];
+    for (int line = 0; line < 64; line++)
+    {
+        const float y = view->Pos.y + view->Size.y * ((float)line + 0.5f) / 64.0f;
+        for (int n = 0; n < IM_ARRAYSIZE(points); n++)
+        {
+            const float x = (float)n / (float)(IM_ARRAYSIZE(points) - 1);
+            points[n] = ImVec2(view->Pos.x + view->Size.x * x, y + 6.0f * sinf(x * 12.0f + (float)line * 0.7f + t));
+        }
+        draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(90, 160 + line, 255, 200), false, 1.0f);
+    }
+    for (int n = 0; n < 256; n++)
+    {
+        const ImVec2 pos(view->Pos.x + (float)((n * 37) % (int)view->Size.x), view->Pos.y + (float)((n * 53 + view->Frame) % (int)view->Size.y));
+        draw_list->AddCircleFilled(pos, 3.0f, IM_COL32(255, 120, 60, 255));
+    }
+    for (int n = 0; n < 16; n++)
+    {
+        char label[32];
+        snprintf(label, IM_ARRAYSIZE(label), "Site %02d: %+.3f", n, sinf(t + (float)n));
+        draw_list->AddText(ImVec2(view->Pos.x + (float)((n * 97) % 400), view->Pos.y + (float)(n * 32 + 8)), IM_COL32_WHITE, label);
+    }
+
+    draw_list->PopClipRect();
+    draw_list->PopTextureID();
+}
+
+static void SceneCanvas(int frame, bool threaded)
+{
+    // Copy of the shared draw data for the workers, refreshed while none of them is running
+    if (g_CanvasSharedData == NULL)
+        g_CanvasSharedData = ImGui::CreateDrawListSharedData();
+    else
+        ImGui::UpdateDrawListSharedData(g_CanvasSharedData);
+
+    const int columns = 4;
+    for (int n = 0; n < IM_ARRAYSIZE(g_CanvasViews); n++)
+    {
+        CanvasView* view = &g_CanvasViews[n];
+        if (view->DrawList == NULL)
+            view->DrawList = IM_NEW(ImDrawList)(g_CanvasSharedData);
+        view->Pos = ImVec2((float)((n % columns) * 480), (float)((n / columns) * 540));
+        view->Size = ImVec2(480, 540);
+        view->FontTexID = ImGui::GetIO().Fonts->TexID;
+        view->Frame = frame;
+    }
+
+    if (threaded)
+    {
+        BenchThread threads[IM_ARRAYSIZE(g_CanvasViews)];
+        for (int n = 0; n < IM_ARRAYSIZE(g_CanvasViews); n++)
+            BenchThreadStart(&threads[n], CanvasViewFill, &g_CanvasViews[n]);
+        for (int n = 0; n < IM_ARRAYSIZE(g_CanvasViews); n++)
+            BenchThreadJoin(&threads[n]);
+    }
+    else
+    {
+        for (int n = 0; n < IM_ARRAYSIZE(g_CanvasViews); n++)
+            CanvasViewFill(&g_CanvasViews[n]);
+    }
+
+    for (int n = 0; n < IM_ARRAYSIZE(g_CanvasViews); n++)
+    {
+        const CanvasView* view = &g_CanvasViews[n];
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Canvas %d", n);
+        ImGui::SetNextWindowPos(view->Pos, ImGuiCond_Always);
+        ImGui::SetNextWindowSize(view->Size, ImGuiCond_Always);
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoDecoration);
+        ImGui::GetWindowDrawList()->AddDrawList(view->DrawList);
+        ImGui::End();
+    }
+}
+
+static void SceneCanvasShutdown()
+{
+    for (int n = 0; n < IM_ARRAYSIZE(g_CanvasViews); n++)
+    {
+        IM_DELETE(g_CanvasViews[n].DrawList);
+        g_CanvasViews[n].DrawList = NULL;
+    }
+    ImGui::DestroyDrawListSharedData(g_CanvasSharedData);
+    g_CanvasSharedData = NULL;
+}
+
+static void SceneDashboardSubmitted(int frame)  { SceneDashboard(frame, false); }
+static void SceneDashboardCached(int frame)     { SceneDashboard(frame, true); }
+static void SceneCanvasSingleThread(int frame)  { SceneCanvas(frame, false); }
+static void SceneCanvasMultiThread(int frame)   { SceneCanvas(frame, true); }
+
+struct BenchScene
+{
+    const char*     Name;
+    void            (*Func)(int frame);
+    void            (*Shutdown)();          // Optional, called before destroying the context
+};
+
+static const BenchScene g_Scenes[] =
+{
+    { "demo",       SceneDemo, NULL },
+    { "list10k",    SceneList, NULL },
+    { "windows1k",  SceneWindows, NULL },
+    { "plots",      ScenePlots, NULL },
+    { "dashboard",  SceneDashboardSubmitted, NULL },
+    { "dashboard_cached", SceneDashboardCached, NULL },
+    { "columns",    SceneColumns, NULL },
+    { "console",    SceneConsole, NULL },
+    { "canvas",     SceneCanvasSingleThread, SceneCanvasShutdown },
+    { "canvas_mt",  SceneCanvasMultiThread, SceneCanvasShutdown },
+};
+
+//-----------------------------------------------------------------------------
+// Scripted inputs
+//-----------------------------------------------------------------------------
+
+// Deterministic inputs: the mouse follows a Lissajous curve, clicks and drags periodically,
+// scrolls the wheel and types characters / presses navigation keys.
+static void ApplyScriptedInputs(ImGuiIO& io, int frame)
+{
+    const float t = (float)frame * (1.0f / 60.0f);
+    io.MousePos = ImVec2(960.0f + 900.0f * sinf(t * 0.7f), 540.0f + 500.0f * sinf(t * 1.1f + 0.5f));
+    io.MouseDown[0] = (frame % 60) >= 50;
+    io.MouseDown[1] = false;
+    io.MouseWheel = ((frame % 30) == 15) ? -1.0f : 0.0f;
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown); n++)
+        io.KeysDown[n] = false;
+    if ((frame % 45) == 20)
+        io.KeysDown[io.KeyMap[ImGuiKey_DownArrow]] = true;
+    if ((frame % 20) == 10)
+        io.AddInputCharacter('a' + (frame / 20) % 26);
+}
+
+//-----------------------------------------------------------------------------
+// ImDrawList microbenchmarks
+//-----------------------------------------------------------------------------
+
+// Spread primitives over the display so they don't all hit the same cache lines, the exact layout doesn't matter.
+static ImVec2 DrawBenchPos(int n)
+{
+    return ImVec2(60.0f + (float)((n * 37) % 1800), 60.0f + (float)((n * 53) % 960));
+}
+
+static ImU32 DrawBenchCol(int n)
+{
+    return IM_COL32(255, (n * 7) & 0xFF, (n * 13) & 0xFF, 255);
+}
+
+static void DrawBenchLine(ImDrawList* draw_list, int n, float thickness)
+{
+    ImVec2 p = DrawBenchPos(n);
+    draw_list->AddLine(p, ImVec2(p.x + 40.0f, p.y + 25.0f), DrawBenchCol(n), thickness);
+}
+
+static void DrawBenchPolyline(ImDrawList* draw_list, int n, bool closed, float thickness)
+{
+    ImVec2 p = DrawBenchPos(n);
+    ImVec2 points[32];
+    for (int i = 0; i < IM_ARRAYSIZE(points); i++)
+        points[i] = ImVec2(p.x + i * 4.0f, p.y + ((i & 1) ? 12.0f : 0.0f) + (float)(i >> 2));
+    draw_list->AddPolyline(points, IM_ARRAYSIZE(points), DrawBenchCol(n), closed, thickness);
+}
+
+// Map-like route: wide line with moderate turns. Joint circles variant is the usual workaround when not using ImDrawLineFlags joins.
+static void DrawBenchRoute(ImDrawList* draw_list, int n, ImDrawLineFlags flags, bool joint_circles)
+{
+    ImVec2 p = DrawBenchPos(n);
+    ImVec2 points[32];
+    for (int i = 0; i < IM_ARRAYSIZE(points); i++)
+        points[i] = ImVec2(p.x + i * 20.0f, p.y + ((i % 3) == 1 ? 14.0f : 0.0f) + ((i % 5) == 2 ? -10.0f : 0.0f));
+    draw_list->AddPolyline(points, IM_ARRAYSIZE(points), DrawBenchCol(n), false, 12.0f, flags);
+    if (joint_circles)
+        for (int i = 1; i + 1 < IM_ARRAYSIZE(points); i++)
+            draw_list->AddCircleFilled(points[i], 6.0f, DrawBenchCol(n));
+}
+
+static void DrawBenchConvexPolyFilled(ImDrawList* draw_list, int n)
+{
+    ImVec2 p = DrawBenchPos(n);
+    ImVec2 points[16];
+    for (int i = 0; i < IM_ARRAYSIZE(points); i++)
+    {
+        const float a = (float)i * (6.2831853f / IM_ARRAYSIZE(points));
+        points[i] = ImVec2(p.x + cosf(a) * 20.0f, p.y + sinf(a) * 20.0f);
+    }
+    draw_list->AddConvexPolyFilled(points, IM_ARRAYSIZE(points), DrawBenchCol(n));
+}
+
+static void DrawBenchLine1(ImDrawList* draw_list, int n)            { DrawBenchLine(draw_list, n, 1.0f); }
+static void DrawBenchLine3(ImDrawList* draw_list, int n)            { DrawBenchLine(draw_list, n, 3.0f); }
+static void DrawBenchPolyline1(ImDrawList* draw_list, int n)        { DrawBenchPolyline(draw_list, n, false, 1.0f); }
+static void DrawBenchPolyline3(ImDrawList* draw_list, int n)        { DrawBenchPolyline(draw_list, n, false, 3.0f); }
+static void DrawBenchPolylineClosed(ImDrawList* draw_list, int n)   { DrawBenchPolyline(draw_list, n, true, 1.0f); }
+static void DrawBenchRoute(ImDrawList* draw_list, int n)            { DrawBenchRoute(draw_list, n, ImDrawLineFlags_None, false); }
+static void DrawBenchRouteCircles(ImDrawList* draw_list, int n)     { DrawBenchRoute(draw_list, n, ImDrawLineFlags_None, true); }
+static void DrawBenchRouteMiter(ImDrawList* draw_list, int n)       { DrawBenchRoute(draw_list, n, ImDrawLineFlags_JoinMiter | ImDrawLineFlags_CapButt, false); }
+static void DrawBenchRouteRound(ImDrawList* draw_list, int n)       { DrawBenchRoute(draw_list, n, ImDrawLineFlags_JoinRound | ImDrawLineFlags_CapRound, false); }
+static void DrawBenchRect(ImDrawList* draw_list, int n)             { ImVec2 p = DrawBenchPos(n); draw_list->AddRect(p, ImVec2(p.x + 50.0f, p.y + 30.0f), DrawBenchCol(n), 0.0f); }
+static void DrawBenchRectRounded(ImDrawList* draw_list, int n)      { ImVec2 p = DrawBenchPos(n); draw_list->AddRect(p, ImVec2(p.x + 50.0f, p.y + 30.0f), DrawBenchCol(n), 8.0f); }
+static void DrawBenchRectFilled(ImDrawList* draw_list, int n)       { ImVec2 p = DrawBenchPos(n); draw_list->AddRectFilled(p, ImVec2(p.x + 50.0f, p.y + 30.0f), DrawBenchCol(n), 0.0f); }
+static void DrawBenchRectFilledRounded(ImDrawList* draw_list, int n){ ImVec2 p = DrawBenchPos(n); draw_list->AddRectFilled(p, ImVec2(p.x + 50.0f, p.y + 30.0f), DrawBenchCol(n), 8.0f); }
+static void DrawBenchCircle4(ImDrawList* draw_list, int n)          { draw_list->AddCircle(DrawBenchPos(n), 4.0f, DrawBenchCol(n)); }
+static void DrawBenchCircle32(ImDrawList* draw_list, int n)         { draw_list->AddCircle(DrawBenchPos(n), 32.0f, DrawBenchCol(n)); }
+static void DrawBenchCircle256(ImDrawList* draw_list, int n)        { draw_list->AddCircle(DrawBenchPos(n), 256.0f, DrawBenchCol(n)); }
+static void DrawBenchCircleFilled4(ImDrawList* draw_list, int n)    { draw_list->AddCircleFilled(DrawBenchPos(n), 4.0f, DrawBenchCol(n)); }
+static void DrawBenchCircleFilled32(ImDrawList* draw_list, int n)   { draw_list->AddCircleFilled(DrawBenchPos(n), 32.0f, DrawBenchCol(n)); }
+static void DrawBenchCircleFilled256(ImDrawList* draw_list, int n)  { draw_list->AddCircleFilled(DrawBenchPos(n), 256.0f, DrawBenchCol(n)); }
+static void DrawBenchArcGauge(ImDrawList* draw_list, int n)         { draw_list->PathArcTo(DrawBenchPos(n), 24.0f, IM_PI * 0.75f, IM_PI * (0.75f + 1.5f * (float)(n % 100) / 100.0f), 24); draw_list->PathStroke(DrawBenchCol(n), false, 4.0f); }
+static void DrawBenchArcPie(ImDrawList* draw_list, int n)           { ImVec2 p = DrawBenchPos(n); float a = (float)(n % 8) * 0.8f; draw_list->PathLineTo(p); draw_list->PathArcTo(p, 32.0f, a, a + 0.8f, 8); draw_list->PathFillConvex(DrawBenchCol(n)); }
+static void DrawBenchBezier(ImDrawList* draw_list, int n)           { ImVec2 p = DrawBenchPos(n); draw_list->AddBezierCurve(p, ImVec2(p.x + 30.0f, p.y - 40.0f), ImVec2(p.x + 70.0f, p.y + 40.0f), ImVec2(p.x + 100.0f, p.y), DrawBenchCol(n), 1.0f); }
+static void DrawBenchBezierQuadratic(ImDrawList* draw_list, int n)  { ImVec2 p = DrawBenchPos(n); draw_list->AddBezierQuadratic(p, ImVec2(p.x + 50.0f, p.y - 60.0f), ImVec2(p.x + 100.0f, p.y), DrawBenchCol(n), 1.0f); }
+static void DrawBenchText(ImDrawList* draw_list, int n)             { draw_list->AddText(DrawBenchPos(n), DrawBenchCol(n), "The quick brown fox jumps over the lazy dog 0123456789"); }
+static void DrawBenchImageRounded(ImDrawList* draw_list, int n)     { ImVec2 p = DrawBenchPos(n); draw_list->AddImageRounded(draw_list->_CmdHeader.TextureId, p, ImVec2(p.x + 64.0f, p.y + 64.0f), ImVec2(0, 0), ImVec2(1, 1), DrawBenchCol(n), 8.0f); }
+static void DrawBenchImage(ImDrawList* draw_list, int n)             { ImVec2 p = DrawBenchPos(n); draw_list->AddImage(draw_list->_CmdHeader.TextureId, p, ImVec2(p.x + 64.0f, p.y + 64.0f), ImVec2(0, 0), ImVec2(1, 1), DrawBenchCol(n)); }
+
+// Batched variants submit the same primitives as their individual counterparts, DRAW_BENCH_BATCH_COUNT at a time on every DRAW_BENCH_BATCH_COUNT-th call.
+// Filling the arrays is part of the measurement, as it would be for an application.
+#define DRAW_BENCH_BATCH_COUNT  100
+
+enum DrawBenchBatchType
+{
+    DrawBenchBatchType_RectFilled,
+    DrawBenchBatchType_Line1,
+    DrawBenchBatchType_CircleFilled4,
+    DrawBenchBatchType_Image,
+    DrawBenchBatchType_Bezier
+};
+
+static void DrawBenchBatch(ImDrawList* draw_list, int n, DrawBenchBatchType type)
+{
+    if ((n % DRAW_BENCH_BATCH_COUNT) != DRAW_BENCH_BATCH_COUNT - 1)
+        return;
+    ImVec2 points[DRAW_BENCH_BATCH_COUNT * 4];
+    ImU32 cols[DRAW_BENCH_BATCH_COUNT];
+    const int n_first = n + 1 - DRAW_BENCH_BATCH_COUNT;
+    for (int i = 0; i < DRAW_BENCH_BATCH_COUNT; i++)
+    {
+        const ImVec2 p = DrawBenchPos(n_first + i);
+        const ImVec2 size = (type == DrawBenchBatchType_RectFilled) ? ImVec2(50.0f, 30.0f) : (type == DrawBenchBatchType_Line1) ? ImVec2(40.0f, 25.0f) : ImVec2(64.0f, 64.0f);
+        if (type == DrawBenchBatchType_CircleFilled4)
+        {
+            points[i] = p; // Centers
+        }
+        else if (type == DrawBenchBatchType_Bezier)
+        {
+            points[i * 4 + 0] = p; // Same curve as DrawBenchBezier()
+            points[i * 4 + 1] = ImVec2(p.x + 30.0f, p.y - 40.0f);
+            points[i * 4 + 2] = ImVec2(p.x + 70.0f, p.y + 40.0f);
+            points[i * 4 + 3] = ImVec2(p.x + 100.0f, p.y);
+        }
+        else
+        {
+            points[i * 2 + 0] = p;
+            points[i * 2 + 1] = ImVec2(p.x + size.x, p.y + size.y);
+        }
+        cols[i] = DrawBenchCol(n_first + i);
+    }
+    switch (type)
+    {
+    case DrawBenchBatchType_RectFilled:     draw_list->AddRectFilledBatch(points, DRAW_BENCH_BATCH_COUNT, cols); break;
+    case DrawBenchBatchType_Line1:          draw_list->AddLinesBatch(points, DRAW_BENCH_BATCH_COUNT, cols, IM_COL32_WHITE, 1.0f); break;
+    case DrawBenchBatchType_CircleFilled4:  draw_list->AddCirclesFilledBatch(points, NULL, DRAW_BENCH_BATCH_COUNT, cols, IM_COL32_WHITE, 4.0f); break;
+    case DrawBenchBatchType_Image:          draw_list->AddImagesBatch(draw_list->_CmdHeader.TextureId, points, NULL, DRAW_BENCH_BATCH_COUNT, cols); break;
+    case DrawBenchBatchType_Bezier:         draw_list->AddBezierCurvesBatch(points, DRAW_BENCH_BATCH_COUNT, cols, IM_COL32_WHITE, 1.0f); break;
+    }
+}
+
+static void DrawBenchRectFilledBatch(ImDrawList* draw_list, int n)      { DrawBenchBatch(draw_list, n, DrawBenchBatchType_RectFilled); }
+static void DrawBenchLine1Batch(ImDrawList* draw_list, int n)           { DrawBenchBatch(draw_list, n, DrawBenchBatchType_Line1); }
+static void DrawBenchCircleFilled4Batch(ImDrawList* draw_list, int n)   { DrawBenchBatch(draw_list, n, DrawBenchBatchType_CircleFilled4); }
+static void DrawBenchImageBatch(ImDrawList* draw_list, int n)           { DrawBenchBatch(draw_list, n, DrawBenchBatchType_Image); }
+static void DrawBenchBezierBatch(ImDrawList* draw_list, int n)          { DrawBenchBatch(draw_list, n, DrawBenchBatchType_Bezier); }
+
+// Canvas variants spread primitives over 4 screens vertically, as in a scrolled canvas: 3 out of 4 are outside of the clip rectangle.
+static ImVec2 DrawBenchCanvasPos(int n)
+{
+    return ImVec2(60.0f + (float)((n * 37) % 1800), 60.0f + (float)((n * 53) % 3840) - 1440.0f);
+}
+
+static void DrawBenchCanvasRectFilled(ImDrawList* draw_list, int n) { ImVec2 p = DrawBenchCanvasPos(n); draw_list->AddRectFilled(p, ImVec2(p.x + 50.0f, p.y + 30.0f), DrawBenchCol(n), 0.0f); }
+static void DrawBenchCanvasCircle32(ImDrawList* draw_list, int n)   { draw_list->AddCircle(DrawBenchCanvasPos(n), 32.0f, DrawBenchCol(n)); }
+
+// A 1024 points plot crossing the clip rectangle vertically, of which about a quarter of the segments are visible
+static void DrawBenchCanvasPolyline(ImDrawList* draw_list, int n)
+{
+    ImVec2 points[1024];
+    const float x = 60.0f + (float)((n * 37) % 1800);
+    for (int i = 0; i < IM_ARRAYSIZE(points); i++)
+        points[i] = ImVec2(x + ((i & 1) ? 8.0f : 0.0f), -1440.0f + i * 3.75f);
+    draw_list->AddPolyline(points, IM_ARRAYSIZE(points), DrawBenchCol(n), false, 1.0f);
+}
+
+// Same rectangles drawn DRAW_BENCH_BATCH_COUNT at a time in a canvas zoomed out and panned with PushTransform()/PopTransform().
+// The transformed positions are verified by the 'Canvas/Transform/...' checks of '--mode check', not here.
+static void DrawBenchCanvasTransformRectFilled(ImDrawList* draw_list, int n)
+{
+    if ((n % DRAW_BENCH_BATCH_COUNT) == 0)
+        draw_list->PushTransform(ImVec2(30.0f, 40.5f), 0.5f);
+    DrawBenchRectFilled(draw_list, n);
+    if ((n % DRAW_BENCH_BATCH_COUNT) == DRAW_BENCH_BATCH_COUNT - 1)
+        draw_list->PopTransform();
+}
+
+enum DrawBenchFlags
+{
+    DrawBenchFlags_None         = ImDrawListFlags_None,
+    DrawBenchFlags_AA           = ImDrawListFlags_AntiAliasedLines,
+    DrawBenchFlags_AATex        = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex,
+    DrawBenchFlags_AAFill       = ImDrawListFlags_AntiAliasedFill,
+    DrawBenchFlags_AATexCorners = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedRoundCornersUseTex,
+    DrawBenchFlags_AAFillTex    = ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AntiAliasedRoundCornersUseTex,
+    DrawBenchFlags_Cull         = ImDrawListFlags_CullClipped
+};
+
+// Rectangles drawn in 24 channels, split and merged every DRAW_BENCH_BATCH_COUNT rectangles
+static void DrawBenchRectFilledChannels(ImDrawList* draw_list, int n)
+{
+    if ((n % DRAW_BENCH_BATCH_COUNT) == 0)
+        draw_list->ChannelsSplit(1 + 24);
+    draw_list->ChannelsSetCurrent(1 + (n % 24));
+    DrawBenchRectFilled(draw_list, n);
+    if ((n % DRAW_BENCH_BATCH_COUNT) == DRAW_BENCH_BATCH_COUNT - 1)
+        draw_list->ChannelsMerge();
+}
+
+// Fragment variant replays the output of DrawBenchPolyline() recorded once with anti-aliasing, translated to the same position.
+static void DrawBenchPolylineFragment(ImDrawList* draw_list, int n)
+{
+    static ImDrawListFragment fragment;
+    if (fragment.IsEmpty())
+    {
+        ImDrawList record_draw_list(draw_list->_Data);
+        record_draw_list._ResetForNewFrame();
+        record_draw_list.Flags = DrawBenchFlags_AA;
+        record_draw_list.PushClipRectFullScreen();
+        record_draw_list.PushTextureID(draw_list->_CmdHeader.TextureId);
+        fragment.Begin(&record_draw_list);
+        DrawBenchPolyline(&record_draw_list, 0, false, 1.0f);
+        fragment.End(&record_draw_list);
+    }
+    const ImVec2 p = DrawBenchPos(n);
+    const ImVec2 p0 = DrawBenchPos(0);
+    draw_list->AddFragment(fragment, ImVec2(p.x - p0.x, p.y - p0.y));
+}
+
+struct DrawBench
+{
+    const char*     Name;
+    int             Flags;          // ImDrawListFlags
+    void            (*Func)(ImDrawList* draw_list, int n);
+};
+
+// Stroke primitives are measured without anti-aliasing, with geometry anti-aliasing and with texture-based anti-aliasing.
+// Filled primitives are measured with and without ImDrawListFlags_AntiAliasedFill.
+// Variants ending with "/cull" set ImDrawListFlags_CullClipped, which draw lists of ImGui windows have by default.
+static const DrawBench g_DrawBenches[] =
+{
+    { "AddLine/thick1/noaa",                DrawBenchFlags_None,    DrawBenchLine1 },
+    { "AddLine/thick1/aa",                  DrawBenchFlags_AA,      DrawBenchLine1 },
+    { "AddLine/thick1/aa_tex",              DrawBenchFlags_AATex,   DrawBenchLine1 },
+    { "AddLine/thick3/noaa",                DrawBenchFlags_None,    DrawBenchLine3 },
+    { "AddLine/thick3/aa",                  DrawBenchFlags_AA,      DrawBenchLine3 },
+    { "AddLine/thick3/aa_tex",              DrawBenchFlags_AATex,   DrawBenchLine3 },
+    { "AddPolyline/32pts/thick1/noaa",      DrawBenchFlags_None,    DrawBenchPolyline1 },
+    { "AddPolyline/32pts/thick1/aa",        DrawBenchFlags_AA,      DrawBenchPolyline1 },
+    { "AddPolyline/32pts/thick1/aa_tex",    DrawBenchFlags_AATex,   DrawBenchPolyline1 },
+    { "AddPolyline/32pts/thick3/noaa",      DrawBenchFlags_None,    DrawBenchPolyline3 },
+    { "AddPolyline/32pts/thick3/aa",        DrawBenchFlags_AA,      DrawBenchPolyline3 },
+    { "AddPolyline/32pts/thick3/aa_tex",    DrawBenchFlags_AATex,   DrawBenchPolyline3 },
+    { "AddPolyline/32pts/closed/aa",        DrawBenchFlags_AA,      DrawBenchPolylineClosed },
+    { "AddPolyline/route32/thick12/aa",     DrawBenchFlags_AA,      DrawBenchRoute },
+    { "AddPolyline/route32/thick12/aa/circles", DrawBenchFlags_AA | DrawBenchFlags_AAFill, DrawBenchRouteCircles },
+    { "AddPolyline/route32/thick12/aa/miter", DrawBenchFlags_AA,    DrawBenchRouteMiter },
+    { "AddPolyline/route32/thick12/aa/round", DrawBenchFlags_AA,    DrawBenchRouteRound },
+    { "AddPolyline/route32/thick12/noaa/round", DrawBenchFlags_None, DrawBenchRouteRound },
+    { "AddRect/rounding0/noaa",             DrawBenchFlags_None,    DrawBenchRect },
+    { "AddRect/rounding0/aa",               DrawBenchFlags_AA,      DrawBenchRect },
+    { "AddRect/rounding0/aa_tex",           DrawBenchFlags_AATex,   DrawBenchRect },
+    { "AddRect/rounding8/noaa",             DrawBenchFlags_None,    DrawBenchRectRounded },
+    { "AddRect/rounding8/aa",               DrawBenchFlags_AA,      DrawBenchRectRounded },
+    { "AddRect/rounding8/aa_tex",           DrawBenchFlags_AATex,   DrawBenchRectRounded },
+    { "AddRect/rounding8/aa_tex_corners",   DrawBenchFlags_AATexCorners, DrawBenchRectRounded },
+    { "AddRectFilled/rounding0",            DrawBenchFlags_AAFill,  DrawBenchRectFilled },
+    { "AddRectFilled/rounding8/noaa",       DrawBenchFlags_None,    DrawBenchRectFilledRounded },
+    { "AddRectFilled/rounding8/aa",         DrawBenchFlags_AAFill,  DrawBenchRectFilledRounded },
+    { "AddRectFilled/rounding8/aa_tex",     DrawBenchFlags_AAFillTex, DrawBenchRectFilledRounded },
+    { "AddCircle/r4/noaa",                  DrawBenchFlags_None,    DrawBenchCircle4 },
+    { "AddCircle/r4/aa",                    DrawBenchFlags_AA,      DrawBenchCircle4 },
+    { "AddCircle/r4/aa_tex",                DrawBenchFlags_AATex,   DrawBenchCircle4 },
+    { "AddCircle/r4/aa_tex_corners",        DrawBenchFlags_AATexCorners, DrawBenchCircle4 },
+    { "AddCircle/r32/noaa",                 DrawBenchFlags_None,    DrawBenchCircle32 },
+    { "AddCircle/r32/aa",                   DrawBenchFlags_AA,      DrawBenchCircle32 },
+    { "AddCircle/r32/aa_tex",               DrawBenchFlags_AATex,   DrawBenchCircle32 },
+    { "AddCircle/r32/aa_tex_corners",       DrawBenchFlags_AATexCorners, DrawBenchCircle32 },
+    { "AddCircle/r256/noaa",                DrawBenchFlags_None,    DrawBenchCircle256 },
+    { "AddCircle/r256/aa",                  DrawBenchFlags_AA,      DrawBenchCircle256 },
+    { "AddCircle/r256/aa_tex",              DrawBenchFlags_AATex,   DrawBenchCircle256 },
+    { "AddCircleFilled/r4/noaa",            DrawBenchFlags_None,    DrawBenchCircleFilled4 },
+    { "AddCircleFilled/r4/aa",              DrawBenchFlags_AAFill,  DrawBenchCircleFilled4 },
+    { "AddCircleFilled/r4/aa_tex",          DrawBenchFlags_AAFillTex, DrawBenchCircleFilled4 },
+    { "AddCircleFilled/r32/noaa",           DrawBenchFlags_None,    DrawBenchCircleFilled32 },
+    { "AddCircleFilled/r32/aa",             DrawBenchFlags_AAFill,  DrawBenchCircleFilled32 },
+    { "AddCircleFilled/r32/aa_tex",         DrawBenchFlags_AAFillTex, DrawBenchCircleFilled32 },
+    { "AddCircleFilled/r256/noaa",          DrawBenchFlags_None,    DrawBenchCircleFilled256 },
+    { "AddCircleFilled/r256/aa",            DrawBenchFlags_AAFill,  DrawBenchCircleFilled256 },
+    { "PathArcTo/gauge/r24/aa",             DrawBenchFlags_AA,      DrawBenchArcGauge },
+    { "PathArcTo/pie/r32/aa",               DrawBenchFlags_AAFill,  DrawBenchArcPie },
+    { "AddBezierCurve/noaa",                DrawBenchFlags_None,    DrawBenchBezier },
+    { "AddBezierCurve/aa",                  DrawBenchFlags_AA,      DrawBenchBezier },
+    { "AddBezierCurve/aa_tex",              DrawBenchFlags_AATex,   DrawBenchBezier },
+    { "AddBezierQuadratic/aa_tex",          DrawBenchFlags_AATex,   DrawBenchBezierQuadratic },
+    { "AddConvexPolyFilled/16pts/noaa",     DrawBenchFlags_None,    DrawBenchConvexPolyFilled },
+    { "AddConvexPolyFilled/16pts/aa",       DrawBenchFlags_AAFill,  DrawBenchConvexPolyFilled },
+    { "AddText/54chars",                    DrawBenchFlags_None,    DrawBenchText },
+    { "AddImageRounded/rounding8",          DrawBenchFlags_AAFill,  DrawBenchImageRounded },
+    { "AddImage",                           DrawBenchFlags_None,    DrawBenchImage },
+    { "AddRectFilledBatch/rounding0",       DrawBenchFlags_AAFill,  DrawBenchRectFilledBatch },
+    { "AddRectFilled/rounding0/channels24", DrawBenchFlags_AAFill,  DrawBenchRectFilledChannels },
+    { "AddLinesBatch/thick1/noaa",          DrawBenchFlags_None,    DrawBenchLine1Batch },
+    { "AddLinesBatch/thick1/aa",            DrawBenchFlags_AA,      DrawBenchLine1Batch },
+    { "AddLinesBatch/thick1/aa_tex",        DrawBenchFlags_AATex,   DrawBenchLine1Batch },
+    { "AddCirclesFilledBatch/r4/noaa",      DrawBenchFlags_None,    DrawBenchCircleFilled4Batch },
+    { "AddCirclesFilledBatch/r4/aa",        DrawBenchFlags_AAFill,  DrawBenchCircleFilled4Batch },
+    { "AddCirclesFilledBatch/r4/aa_tex",    DrawBenchFlags_AAFillTex, DrawBenchCircleFilled4Batch },
+    { "AddImagesBatch",                     DrawBenchFlags_None,    DrawBenchImageBatch },
+    { "AddBezierCurvesBatch/aa_tex",        DrawBenchFlags_AATex,   DrawBenchBezierBatch },
+    { "AddFragment/polyline32/aa",          DrawBenchFlags_None,    DrawBenchPolylineFragment },
+    { "AddRectFilled/rounding0/cull",       DrawBenchFlags_AAFill | DrawBenchFlags_Cull, DrawBenchRectFilled },
+    { "AddCircle/r32/aa_tex/cull",          DrawBenchFlags_AATex | DrawBenchFlags_Cull, DrawBenchCircle32 },
+    { "Canvas/AddRectFilled",               DrawBenchFlags_AAFill,  DrawBenchCanvasRectFilled },
+    { "Canvas/AddRectFilled/cull",          DrawBenchFlags_AAFill | DrawBenchFlags_Cull, DrawBenchCanvasRectFilled },
+    { "Canvas/AddCircle/r32/aa_tex",        DrawBenchFlags_AATex,   DrawBenchCanvasCircle32 },
+    { "Canvas/AddCircle/r32/aa_tex/cull",   DrawBenchFlags_AATex | DrawBenchFlags_Cull, DrawBenchCanvasCircle32 },
+    { "Canvas/AddPolyline/1024pts/aa",      DrawBenchFlags_AA,      DrawBenchCanvasPolyline },
+    { "Canvas/AddPolyline/1024pts/aa/cull", DrawBenchFlags_AA | DrawBenchFlags_Cull, DrawBenchCanvasPolyline },
+    { "Canvas/PushTransform/AddRectFilled", DrawBenchFlags_None,    DrawBenchCanvasTransformRectFilled },
+};
+
+struct DrawBenchResult
+{
+    const char*     Name;
+    int             Prims;
+    double          Time;
+    double          VtxCount, IdxCount;
+};
+
+// Submit batches of primitives into a standalone ImDrawList until 'min_time' has elapsed.
+// Resetting the draw list between batches keeps its buffers allocated, as happens with window draw lists across frames.
+static void RunDrawBench(const DrawBench& bench, double min_time, DrawBenchResult* out)
+{
+    const int batch_size = 1000;
+    memset(out, 0, sizeof(*out));
+    out->Name = bench.Name;
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    for (int batch = -1; out->Time < min_time; batch++)
+    {
+        draw_list._ResetForNewFrame();
+        draw_list.Flags = bench.Flags | ImDrawListFlags_AllowVtxOffset;
+        draw_list.PushClipRectFullScreen();
+        draw_list.PushTextureID(ImGui::GetIO().Fonts->TexID);
+
+        const double t0 = GetTimeInSeconds();
+        for (int n = 0; n < batch_size; n++)
+            bench.Func(&draw_list, n);
+        const double t1 = GetTimeInSeconds();
+        if (batch < 0) // First batch grows the buffers, don't measure it
+            continue;
+        out->Time += t1 - t0;
+        out->Prims += batch_size;
+        out->VtxCount += draw_list.VtxBuffer.Size;
+        out->IdxCount += draw_list.IdxBuffer.Size;
+    }
+}
+
+static void WriteDrawBenchResults(FILE* f, const DrawBenchResult* results, int results_count, bool json)
+{
+    if (json)
+        fprintf(f, "[\n");
+    else
+        fprintf(f, "bench,prims,time_ms,prims_per_sec,vtx_per_sec,idx_per_sec,vtx_per_prim,idx_per_prim\n");
+    for (int n = 0; n < results_count; n++)
+    {
+        const DrawBenchResult& r = results[n];
+        const double inv_time = (r.Time > 0.0) ? 1.0 / r.Time : 0.0;
+        const double inv_prims = (r.Prims > 0) ? 1.0 / r.Prims : 0.0;
+        if (json)
+            fprintf(f, "  { \"bench\": \"%s\", \"prims\": %d, \"time_ms\": %.3f, \"prims_per_sec\": %.0f, \"vtx_per_sec\": %.0f, \"idx_per_sec\": %.0f, \"vtx_per_prim\": %.2f, \"idx_per_prim\": %.2f }%s\n",
+                r.Name, r.Prims, r.Time * 1000.0, r.Prims * inv_time, r.VtxCount * inv_time, r.IdxCount * inv_time, r.VtxCount * inv_prims, r.IdxCount * inv_prims, (n + 1 < results_count) ? "," : "");
+        else
+            fprintf(f, "%s,%d,%.3f,%.0f,%.0f,%.0f,%.2f,%.2f\n",
+                r.Name, r.Prims, r.Time * 1000.0, r.Prims * inv_time, r.VtxCount * inv_time, r.IdxCount * inv_time, r.VtxCount * inv_prims, r.IdxCount * inv_prims);
+    }
+    if (json)
+        fprintf(f, "]\n");
+}
+
+//-----------------------------------------------------------------------------
+// ImDrawList checks
+//-----------------------------------------------------------------------------
+
+// Regression checks of ImDrawList output, run by '--mode check' outside of any timing and regardless of IM_ASSERT being enabled.
+// Each check gets a draw list set up like the microbenchmark ones, and returns false after printing what failed.
+static bool DrawCheckFail(const char* name, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "%s: ", name);
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    return false;
+}
+
+// Elements added after Begin() into the command which was current before Begin() (merged back by restoring its clip rectangle)
+static bool DrawCheckFragmentMergedCmd(ImDrawList* draw_list)
+{
+    const char* name = "Fragment/MergedCmd";
+    const ImVec2 a_min(0, 0), a_max(800, 600), b_min(100, 100), b_max(200, 200);
+    draw_list->PushClipRect(a_min, a_max);
+    draw_list->AddRectFilled(ImVec2(10, 10), ImVec2(20, 20), IM_COL32_WHITE);
+    draw_list->PushClipRect(b_min, b_max);
+    ImDrawListFragment fragment;
+    fragment.Begin(draw_list);
+    draw_list->PushClipRect(a_min, a_max, false);
+    draw_list->AddRectFilled(ImVec2(30, 30), ImVec2(40, 40), IM_COL32_WHITE);
+    draw_list->PopClipRect();
+    draw_list->AddRectFilled(ImVec2(110, 110), ImVec2(120, 120), IM_COL32_WHITE);
+    fragment.End(draw_list);
+    draw_list->PopClipRect();
+    draw_list->PopClipRect();
+
+    int elem_count = 0;
+    for (int n = 0; n < fragment.CmdBuffer.Size; n++)
+        elem_count += (int)fragment.CmdBuffer[n].ElemCount;
+    if (fragment.IdxBuffer.Size != 12 || elem_count != 12)
+        return DrawCheckFail(name, "expected 12 indices in commands, got %d indices and %d in commands", fragment.IdxBuffer.Size, elem_count);
+    if (fragment.CmdBuffer.Size != 2 || fragment.CmdBuffer[0].ClipRect.z != a_max.x || fragment.CmdBuffer[1].ClipRect.z != b_max.x)
+        return DrawCheckFail(name, "expected 2 commands clipped by A then B, got %d commands", fragment.CmdBuffer.Size);
+    return true;
+}
+
+// Sum of the areas of the triangles from 'idx_begin', overlapping triangles are counted twice
+static float DrawCheckTrianglesArea(const ImDrawList* draw_list, int idx_begin)
+{
+    float area = 0.0f;
+    for (int n = idx_begin; n + 2 < draw_list->IdxBuffer.Size; n += 3)
+        area += ImTriangleArea(draw_list->VtxBuffer[draw_list->IdxBuffer[n]].pos, draw_list->VtxBuffer[draw_list->IdxBuffer[n + 1]].pos, draw_list->VtxBuffer[draw_list->IdxBuffer[n + 2]].pos);
+    return area;
+}
+
+// Rounding of a single corner larger than half of the rectangle width, which doesn't fit the baked corners quads
+static bool DrawCheckRectFilledLargeCorner(ImDrawList* draw_list)
+{
+    const char* name = "AddRectFilled/LargeCorner";
+    draw_list->Flags |= ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AntiAliasedRoundCornersUseTex;
+    const ImVec2 p_min(0, 0), p_max(20, 100);
+    const int idx_begin = draw_list->IdxBuffer.Size;
+    draw_list->AddRectFilled(p_min, p_max, IM_COL32_WHITE, 15.0f, ImDrawCornerFlags_TopLeft);
+
+    // Anti-aliasing adds at most a 1 pixel fringe along the edges
+    const float area = DrawCheckTrianglesArea(draw_list, idx_begin);
+    const float area_max = (p_max.x - p_min.x) * (p_max.y - p_min.y) + (p_max.x - p_min.x + p_max.y - p_min.y) * 2.0f;
+    if (area > area_max)
+        return DrawCheckFail(name, "triangles cover %.1f, more than the rectangle (%.1f with fringe)", area, area_max);
+    return true;
+}
+
+// Command drawing the index 'idx', or NULL
+static const ImDrawCmd* DrawCheckFindCmd(const ImDrawList* draw_list, int idx)
+{
+    for (int n = 0; n < draw_list->CmdBuffer.Size; n++)
+    {
+        const ImDrawCmd& cmd = draw_list->CmdBuffer[n];
+        if (idx >= (int)cmd.IdxOffset && idx < (int)(cmd.IdxOffset + cmd.ElemCount))
+            return &cmd;
+    }
+    return NULL;
+}
+
+// Clip rectangle pushed after PushTransform() equal to the one before it: still in canvas coordinates, not merged with the command before
+static bool DrawCheckCanvasClipRectMerge(ImDrawList* draw_list)
+{
+    const char* name = "Canvas/ClipRectMerge";
+    draw_list->PushClipRect(ImVec2(0, 0), ImVec2(800, 600));
+    draw_list->AddRectFilled(ImVec2(10, 10), ImVec2(20, 20), IM_COL32_WHITE);
+    draw_list->PushTransform(ImVec2(0, 0), 0.5f);
+    draw_list->PushClipRect(ImVec2(0, 0), ImVec2(800, 600), true);
+    const int idx_begin = draw_list->IdxBuffer.Size;
+    draw_list->AddRectFilled(ImVec2(10, 10), ImVec2(20, 20), IM_COL32_WHITE);
+    draw_list->PopClipRect();
+    draw_list->PopTransform();
+    draw_list->PopClipRect();
+
+    const ImDrawCmd* cmd = DrawCheckFindCmd(draw_list, idx_begin);
+    if (cmd == NULL || cmd->ClipRect.x != 0.0f || cmd->ClipRect.y != 0.0f || cmd->ClipRect.z != 400.0f || cmd->ClipRect.w != 300.0f)
+        return DrawCheckFail(name, "expected clip rectangle (0,0,400,300), got (%.1f,%.1f,%.1f,%.1f)",
+            cmd ? cmd->ClipRect.x : 0.0f, cmd ? cmd->ClipRect.y : 0.0f, cmd ? cmd->ClipRect.z : 0.0f, cmd ? cmd->ClipRect.w : 0.0f);
+    return true;
+}
+
+struct DrawCheckTransform
+{
+    ImVec2          Translation;
+    float           Scale;
+    float           Rotation;
+};
+
+// Expected position on screen of 'p' drawn under 'transforms[0]' (outermost) to 'transforms[transforms_count - 1]'
+static ImVec2 DrawCheckTransformPos(const DrawCheckTransform* transforms, int transforms_count, ImVec2 p)
+{
+    for (int n = transforms_count - 1; n >= 0; n--)
+    {
+        const DrawCheckTransform& t = transforms[n];
+        const float c = ImCos(t.Rotation) * t.Scale, s = ImSin(t.Rotation) * t.Scale;
+        p = ImVec2(t.Translation.x + p.x * c - p.y * s, t.Translation.y + p.x * s + p.y * c);
+    }
+    return p;
+}
+
+// Rectangle drawn under nested transforms, whose 4 vertices (without anti-aliasing) are compared to the expected positions.
+// The tolerance is the 1/8 pixel precision of IMGUI_USE_COMPACT_DRAWVERT positions.
+static bool DrawCheckTransformedRect(const char* name, ImDrawList* draw_list, const DrawCheckTransform* transforms, int transforms_count, ImVec2 p_min, ImVec2 p_max)
+{
+    for (int n = 0; n < transforms_count; n++)
+        draw_list->PushTransform(transforms[n].Translation, transforms[n].Scale, transforms[n].Rotation);
+    const int vtx_begin = draw_list->VtxBuffer.Size;
+    draw_list->AddRectFilled(p_min, p_max, IM_COL32_WHITE);
+    for (int n = 0; n < transforms_count; n++)
+        draw_list->PopTransform();
+
+    if (draw_list->VtxBuffer.Size - vtx_begin != 4)
+        return DrawCheckFail(name, "expected 4 vertices, got %d", draw_list->VtxBuffer.Size - vtx_begin);
+    const ImVec2 corners[4] = { p_min, ImVec2(p_max.x, p_min.y), p_max, ImVec2(p_min.x, p_max.y) };
+    for (int n = 0; n < 4; n++)
+    {
+        const ImVec2 expected = DrawCheckTransformPos(transforms, transforms_count, corners[n]);
+        const ImVec2 pos = draw_list->VtxBuffer[vtx_begin + n].pos;
+        if (ImFabs(pos.x - expected.x) > 0.125f || ImFabs(pos.y - expected.y) > 0.125f)
+            return DrawCheckFail(name, "vertex %d at (%.3f,%.3f), expected (%.3f,%.3f)", n, pos.x, pos.y, expected.x, expected.y);
+    }
+    return true;
+}
+
+// Canvas coordinates far outside of the 16-bit range of IMGUI_USE_COMPACT_DRAWVERT positions, zoomed out to fit on screen
+static bool DrawCheckCanvasTransformZoomOut(ImDrawList* draw_list)
+{
+    const DrawCheckTransform t = { ImVec2(30.0f, 40.5f), 0.1f, 0.0f };
+    return DrawCheckTransformedRect("Canvas/Transform/ZoomOut", draw_list, &t, 1, ImVec2(30000.0f, -20000.0f), ImVec2(30050.0f, -19970.0f));
+}
+
+// Canvas coordinates finer than the precision of IMGUI_USE_COMPACT_DRAWVERT positions, zoomed in
+static bool DrawCheckCanvasTransformZoomIn(ImDrawList* draw_list)
+{
+    const DrawCheckTransform t = { ImVec2(30.0f, 40.5f), 16.0f, 0.0f };
+    return DrawCheckTransformedRect("Canvas/Transform/ZoomIn", draw_list, &t, 1, ImVec2(10.03f, 10.03f), ImVec2(20.0f, 20.0f));
+}
+
+static bool DrawCheckCanvasTransformRotate(ImDrawList* draw_list)
+{
+    const DrawCheckTransform t = { ImVec2(400.0f, 300.0f), 2.0f, 0.5f };
+    return DrawCheckTransformedRect("Canvas/Transform/Rotate", draw_list, &t, 1, ImVec2(-50.0f, -20.0f), ImVec2(50.0f, 20.0f));
+}
+
+static bool DrawCheckCanvasTransformNested(ImDrawList* draw_list)
+{
+    const DrawCheckTransform t[3] = { { ImVec2(100.0f, 50.0f), 0.25f, 0.0f }, { ImVec2(2000.0f, 1000.0f), 0.5f, -0.3f }, { ImVec2(-40.0f, 8.0f), 8.0f, 0.0f } };
+    return DrawCheckTransformedRect("Canvas/Transform/Nested", draw_list, t, IM_ARRAYSIZE(t), ImVec2(5.0f, 5.0f), ImVec2(25.125f, 15.0f));
+}
+
+// Clip rectangles pushed under nested transforms are transformed and intersected with the outer ones
+static bool DrawCheckCanvasTransformNestedClipRect(ImDrawList* draw_list)
+{
+    const char* name = "Canvas/Transform/NestedClipRect";
+    draw_list->PushTransform(ImVec2(100.0f, 50.0f), 0.5f);
+    draw_list->PushClipRect(ImVec2(0.0f, 0.0f), ImVec2(400.0f, 400.0f), true);  // (100,50)-(300,250) on screen
+    draw_list->PushTransform(ImVec2(20.0f, 20.0f), 2.0f);
+    draw_list->PushClipRect(ImVec2(0.0f, 0.0f), ImVec2(200.0f, 200.0f), true);  // (110,60)-(310,260) on screen, intersected
+    const int idx_inner = draw_list->IdxBuffer.Size;
+    draw_list->AddRectFilled(ImVec2(10.0f, 10.0f), ImVec2(20.0f, 20.0f), IM_COL32_WHITE);
+    draw_list->PopClipRect();
+    draw_list->PopTransform();
+    const int idx_outer = draw_list->IdxBuffer.Size;
+    draw_list->AddRectFilled(ImVec2(10.0f, 10.0f), ImVec2(20.0f, 20.0f), IM_COL32_WHITE);
+    draw_list->PopClipRect();
+    draw_list->PopTransform();
+
+    const ImVec4 expected[2] = { ImVec4(110.0f, 60.0f, 300.0f, 250.0f), ImVec4(100.0f, 50.0f, 300.0f, 250.0f) };
+    const int idx[2] = { idx_inner, idx_outer };
+    for (int n = 0; n < 2; n++)
+    {
+        const ImDrawCmd* cmd = DrawCheckFindCmd(draw_list, idx[n]);
+        const ImVec4 r = cmd ? cmd->ClipRect : ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+        if (ImFabs(r.x - expected[n].x) > 0.001f || ImFabs(r.y - expected[n].y) > 0.001f || ImFabs(r.z - expected[n].z) > 0.001f || ImFabs(r.w - expected[n].w) > 0.001f)
+            return DrawCheckFail(name, "%s rectangle clipped by (%.1f,%.1f,%.1f,%.1f), expected (%.1f,%.1f,%.1f,%.1f)", n == 0 ? "inner" : "outer",
+                r.x, r.y, r.z, r.w, expected[n].x, expected[n].y, expected[n].z, expected[n].w);
+    }
+    return true;
+}
+
+struct DrawCheck
+{
+    const char*     Name;
+    bool            (*Func)(ImDrawList* draw_list);
+};
+
+static const DrawCheck g_DrawChecks[] =
+{
+    { "Fragment/MergedCmd",                 DrawCheckFragmentMergedCmd },
+    { "AddRectFilled/LargeCorner",          DrawCheckRectFilledLargeCorner },
+    { "Canvas/ClipRectMerge",               DrawCheckCanvasClipRectMerge },
+    { "Canvas/Transform/ZoomOut",           DrawCheckCanvasTransformZoomOut },
+    { "Canvas/Transform/ZoomIn",            DrawCheckCanvasTransformZoomIn },
+    { "Canvas/Transform/Rotate",            DrawCheckCanvasTransformRotate },
+    { "Canvas/Transform/Nested",            DrawCheckCanvasTransformNested },
+    { "Canvas/Transform/NestedClipRect",    DrawCheckCanvasTransformNestedClipRect },
+};
+
+struct DrawCheckResult
+{
+    const char*     Name;
+    bool            Passed;
+};
+
+static void RunDrawCheck(const DrawCheck& check, DrawCheckResult* out)
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    draw_list._ResetForNewFrame();
+    draw_list.Flags = ImDrawListFlags_AllowVtxOffset;
+    draw_list.PushClipRectFullScreen();
+    draw_list.PushTextureID(ImGui::GetIO().Fonts->TexID);
+    out->Name = check.Name;
+    out->Passed = check.Func(&draw_list);
+}
+
+static void WriteDrawCheckResults(FILE* f, const DrawCheckResult* results, int results_count, bool json)
+{
+    if (json)
+        fprintf(f, "[\n");
+    else
+        fprintf(f, "check,passed\n");
+    for (int n = 0; n < results_count; n++)
+    {
+        const DrawCheckResult& r = results[n];
+        if (json)
+            fprintf(f, "  { \"check\": \"%s\", \"passed\": %s }%s\n", r.Name, r.Passed ? "true" : "false", (n + 1 < results_count) ? "," : "");
+        else
+            fprintf(f, "%s,%d\n", r.Name, r.Passed ? 1 : 0);
+    }
+    if (json)
+        fprintf(f, "]\n");
+}
+
+//-----------------------------------------------------------------------------
+// Font atlas build benchmarks
+//-----------------------------------------------------------------------------
+
+// TTF files are loaded once and shared by all builds (FontDataOwnedByAtlas = false), so file I/O isn't measured.
+// The last entry is the optional '--font-file', e.g. to measure rasterization of CJK glyphs which misc/fonts doesn't have.
+struct FontFileData
+{
+    void*           Data;
+    int             Size;
+};
+
+static const char* g_FontFiles[] = { "Cousine-Regular.ttf", "DroidSans.ttf", "Karla-Regular.ttf", "ProggyClean.ttf", "ProggyTiny.ttf", "Roboto-Medium.ttf" };
+static FontFileData g_FontFilesData[IM_ARRAYSIZE(g_FontFiles) + 1];
+
+static bool LoadFontFile(const char* filename, FontFileData* out)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return false;
+    fseek(f, 0, SEEK_END);
+    const long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    out->Data = (size > 0) ? malloc((size_t)size) : NULL;
+    out->Size = out->Data ? (int)fread(out->Data, 1, (size_t)size, f) : 0;
+    fclose(f);
+    return out->Data != NULL && out->Size == size;
+}
+
+static void AddFontFiles(ImFontAtlas* atlas, const ImWchar* glyph_ranges)
+{
+    for (int n = 0; n < IM_ARRAYSIZE(g_FontFilesData); n++)
+    {
+        if (g_FontFilesData[n].Data == NULL)
+            continue;
+        ImFontConfig cfg;
+        cfg.FontDataOwnedByAtlas = false;
+        atlas->AddFontFromMemoryTTF(g_FontFilesData[n].Data, g_FontFilesData[n].Size, 16.0f, &cfg, glyph_ranges);
+    }
+}
+
+static void FontAtlasBenchDefault(ImFontAtlas* atlas)       { atlas->AddFontDefault(); }
+static void FontAtlasBenchFonts(ImFontAtlas* atlas)         { AddFontFiles(atlas, atlas->GetGlyphRangesDefault()); }
+static void FontAtlasBenchChineseFull(ImFontAtlas* atlas)   { AddFontFiles(atlas, atlas->GetGlyphRangesChineseFull()); }
+static void FontAtlasBenchJapanese(ImFontAtlas* atlas)      { AddFontFiles(atlas, atlas->GetGlyphRangesJapanese()); }
+
+enum FontAtlasBuilder
+{
+    FontAtlasBuilder_StbTruetype,       // ImFontAtlas::Build()
+    FontAtlasBuilder_FreeType           // ImGuiFreeType::BuildFontAtlas()
+};
+
+struct FontAtlasBench
+{
+    const char*         Name;
+    FontAtlasBuilder    Builder;
+    void                (*AddFonts)(ImFontAtlas* atlas);
+};
+
+static const FontAtlasBench g_FontAtlasBenches[] =
+{
+    { "stb_truetype/default",           FontAtlasBuilder_StbTruetype,   FontAtlasBenchDefault },
+    { "stb_truetype/fonts",             FontAtlasBuilder_StbTruetype,   FontAtlasBenchFonts },
+    { "stb_truetype/fonts_chinese_full",FontAtlasBuilder_StbTruetype,   FontAtlasBenchChineseFull },
+    { "stb_truetype/fonts_japanese",    FontAtlasBuilder_StbTruetype,   FontAtlasBenchJapanese },
+#ifdef IMGUI_ENABLE_FREETYPE
+    { "freetype/default",               FontAtlasBuilder_FreeType,      FontAtlasBenchDefault },
+    { "freetype/fonts",                 FontAtlasBuilder_FreeType,      FontAtlasBenchFonts },
+    { "freetype/fonts_chinese_full",    FontAtlasBuilder_FreeType,      FontAtlasBenchChineseFull },
+    { "freetype/fonts_japanese",        FontAtlasBuilder_FreeType,      FontAtlasBenchJapanese },
+#endif
+};
+
+// Steps of a build, as recorded by the profiler. Building without '#define IMGUI_DEBUG_PROFILER' only measures and reports the total time.
+#ifdef IMGUI_DEBUG_PROFILER
+static const ImGuiProfilerPhase g_FontAtlasPhases[] = { ImGuiProfilerPhase_FontAtlasGlyphLookup, ImGuiProfilerPhase_FontAtlasPackRects, ImGuiProfilerPhase_FontAtlasRasterize, ImGuiProfilerPhase_FontAtlasFinish };
+static const char* g_FontAtlasPhaseNames[] = { "glyph_lookup", "pack_rects", "rasterize", "finish" };
+#endif
+
+struct FontAtlasBenchResult
+{
+    const char*     Name;
+    int             Builds;
+    double          Time;
+#ifdef IMGUI_DEBUG_PROFILER
+    double          PhaseTime[IM_ARRAYSIZE(g_FontAtlasPhases)];
+#endif
+    int             GlyphsCount;
+    int             TexWidth, TexHeight;
+};
+
+static bool BuildFontAtlas(ImFontAtlas* atlas, FontAtlasBuilder builder)
+{
+#ifdef IMGUI_ENABLE_FREETYPE
+    if (builder == FontAtlasBuilder_FreeType)
+        return ImGuiFreeType::BuildFontAtlas(atlas);
+#endif
+    IM_UNUSED(builder);
+    return atlas->Build();
+}
+
+// Rebuild the atlas until 'min_time' has elapsed. Adding the fonts (which for the default font includes decompressing it) isn't measured.
+static void RunFontAtlasBench(const FontAtlasBench& bench, double min_time, FontAtlasBenchResult* out)
+{
+    memset(out, 0, sizeof(*out));
+    out->Name = bench.Name;
+
+    ImFontAtlas atlas;
+    for (int build = -1; build < 1 || out->Time < min_time; build++)
+    {
+        atlas.Clear();
+        bench.AddFonts(&atlas);
+#ifdef IMGUI_DEBUG_PROFILER
+        ImGuiContext& g = *ImGui::GetCurrentContext();
+        double phase_time_start[IM_ARRAYSIZE(g_FontAtlasPhases)];
+        for (int phase = 0; phase < IM_ARRAYSIZE(g_FontAtlasPhases); phase++)
+            phase_time_start[phase] = g.ProfilerPhaseTotalTime[g_FontAtlasPhases[phase]];
+#endif
+
+        const double t0 = GetTimeInSeconds();
+        BuildFontAtlas(&atlas, bench.Builder);
+        const double t1 = GetTimeInSeconds();
+        if (build < 0) // First build warms up caches and the allocator, don't measure it
+            continue;
+        out->Time += t1 - t0;
+        out->Builds++;
+#ifdef IMGUI_DEBUG_PROFILER
+        for (int phase = 0; phase < IM_ARRAYSIZE(g_FontAtlasPhases); phase++)
+            out->PhaseTime[phase] += g.ProfilerPhaseTotalTime[g_FontAtlasPhases[phase]] - phase_time_start[phase];
+#endif
+    }
+
+    for (int n = 0; n < atlas.Fonts.Size; n++)
+        out->GlyphsCount += atlas.Fonts[n]->Glyphs.Size;
+    out->TexWidth = atlas.TexWidth;
+    out->TexHeight = atlas.TexHeight;
+}
+
+static void WriteFontAtlasBenchResults(FILE* f, const FontAtlasBenchResult* results, int results_count, bool json)
+{
+    if (json)
+        fprintf(f, "[\n");
+    else
+    {
+        fprintf(f, "bench,builds,build_ms");
+#ifdef IMGUI_DEBUG_PROFILER
+        for (int phase = 0; phase < IM_ARRAYSIZE(g_FontAtlasPhases); phase++)
+            fprintf(f, ",%s_ms", g_FontAtlasPhaseNames[phase]);
+#endif
+        fprintf(f, ",glyphs,tex_width,tex_height\n");
+    }
+    for (int n = 0; n < results_count; n++)
+    {
+        const FontAtlasBenchResult& r = results[n];
+        const double inv_builds = (r.Builds > 0) ? 1.0 / r.Builds : 0.0;
+        if (json)
+        {
+            fprintf(f, "  { \"bench\": \"%s\", \"builds\": %d, \"build_ms\": %.3f", r.Name, r.Builds, r.Time * inv_builds * 1000.0);
+#ifdef IMGUI_DEBUG_PROFILER
+            for (int phase = 0; phase < IM_ARRAYSIZE(g_FontAtlasPhases); phase++)
+                fprintf(f, ", \"%s_ms\": %.3f", g_FontAtlasPhaseNames[phase], r.PhaseTime[phase] * inv_builds * 1000.0);
+#endif
+            fprintf(f, ", \"glyphs\": %d, \"tex_width\": %d, \"tex_height\": %d }%s\n", r.GlyphsCount, r.TexWidth, r.TexHeight, (n + 1 < results_count) ? "," : "");
+        }
+        else
+        {
+            fprintf(f, "%s,%d,%.3f", r.Name, r.Builds, r.Time * inv_builds * 1000.0);
+#ifdef IMGUI_DEBUG_PROFILER
+            for (int phase = 0; phase < IM_ARRAYSIZE(g_FontAtlasPhases); phase++)
+                fprintf(f, ",%.3f", r.PhaseTime[phase] * inv_builds * 1000.0);
+#endif
+            fprintf(f, ",%d,%d,%d\n", r.GlyphsCount, r.TexWidth, r.TexHeight);
+        }
+    }
+    if (json)
+        fprintf(f, "]\n");
+}
+
+//-----------------------------------------------------------------------------
+// Text benchmarks
+//-----------------------------------------------------------------------------
+
+// Corpora are generated with a fixed seed so they are identical across runs and commits.
+// The default font has no glyphs for most non-Latin characters: pass a '--font-file' (merged with the ChineseFull ranges)
+// to measure glyph lookups that hit actual glyphs rather than the fallback one.
+static const int        TEXT_CORPUS_SIZE = 64 * 1024;   // Approximate size of each corpus, in bytes
+static const int        TEXT_BLOCK_LINES = 16;          // RenderText() is called for blocks of lines, as a scrolling text view would
+static const float      TEXT_WRAP_WIDTH = 400.0f;
+static unsigned int     g_TextRandSeed = 0;
+
+static int TextRand(int range)
+{
+    g_TextRandSeed = g_TextRandSeed * 1664525u + 1013904223u;
+    return (int)((g_TextRandSeed >> 8) % (unsigned int)range);
+}
+
+static void TextAppendWords(ImGuiTextBuffer* out, const char* const* words, int words_count, int count)
+{
+    for (int n = 0; n < count; n++)
+    {
+        if (n > 0)
+            out->append((TextRand(8) == 0) ? ", " : " ");
+        out->append(words[TextRand(words_count)]);
+    }
+}
+
+static const char* g_TextWordsAscii[] = { "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "frame", "window", "buffer", "vertex", "texture", "request", "timeout", "connection", "0x1F3A", "42", "3.14159", "user_id=1337", "(retry)", "/var/log/app", "OK" };
+static const char* g_TextWordsUtf8[] =
+{
+    "caf\xC3\xA9", "na\xC3\xAFve", "Gr\xC3\xB6\xC3\x9F" "e", "\xC3\xA5ngstr\xC3\xB6m", "se\xC3\xB1or",                 // Latin-1 Supplement
+    "\xCE\x95\xCE\xBB\xCE\xBB\xCE\xAC\xCE\xB4\xCE\xB1", "\xCE\xB1\xCE\xB2\xCE\xB3",                                     // Greek
+    "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82", "\xD0\xBC\xD0\xB8\xD1\x80",                                     // Cyrillic
+    "\xE2\x82\xAC" "100", "\xE2\x86\x92", "\xE2\x9C\x93", "\xE6\x97\xA5\xE6\x9C\xAC",                                   // Euro sign, arrow, check mark, CJK
+    "window", "frame", "text", "hello", "world", "12.5%",
+};
+
+static void BuildCorpusAsciiLog(ImGuiTextBuffer* out)
+{
+    static const char* levels[] = { "TRACE", "DEBUG", "INFO", "WARN", "ERROR" };
+    static const char* modules[] = { "net", "render", "audio", "physics", "io", "script" };
+    for (int line = 0; out->size() < TEXT_CORPUS_SIZE; line++)
+    {
+        out->appendf("[%02d:%02d:%02d.%03d] %-5s %-8s ", (line / 360000) % 24, (line / 6000) % 60, (line / 100) % 60, (line * 7) % 1000, levels[TextRand(IM_ARRAYSIZE(levels))], modules[TextRand(IM_ARRAYSIZE(modules))]);
+        TextAppendWords(out, g_TextWordsAscii, IM_ARRAYSIZE(g_TextWordsAscii), 3 + TextRand(12));
+        out->append("\n");
+    }
+}
+
+static void BuildCorpusUtf8Mixed(ImGuiTextBuffer* out)
+{
+    while (out->size() < TEXT_CORPUS_SIZE)
+    {
+        TextAppendWords(out, g_TextWordsUtf8, IM_ARRAYSIZE(g_TextWordsUtf8), 4 + TextRand(12));
+        out->append("\n");
+    }
+}
+
+static void BuildCorpusCJK(ImGuiTextBuffer* out)
+{
+    while (out->size() < TEXT_CORPUS_SIZE)
+    {
+        // Sentences of random CJK Unified Ideographs, with no blanks to wrap at
+        for (int sentence = 1 + TextRand(3); sentence > 0; sentence--)
+        {
+            ImWchar text[41];
+            const int text_len = 10 + TextRand(30);
+            for (int n = 0; n < text_len; n++)
+                text[n] = (ImWchar)(0x4E00 + TextRand(0x5000));
+            text[text_len] = 0x3002; // Ideographic full stop
+            char buf[41 * 3 + 1];
+            ImTextStrToUtf8(buf, IM_ARRAYSIZE(buf), text, text + text_len + 1);
+            out->append(buf);
+        }
+        out->append("\n");
+    }
+}
+
+static void BuildCorpusLongLine(ImGuiTextBuffer* out)
+{
+    while (out->size() < TEXT_CORPUS_SIZE)
+    {
+        TextAppendWords(out, g_TextWordsAscii, IM_ARRAYSIZE(g_TextWordsAscii), 16);
+        out->append(" ");
+    }
+}
+
+static void BuildCorpusParagraphs(ImGuiTextBuffer* out)
+{
+    while (out->size() < TEXT_CORPUS_SIZE)
+    {
+        for (int sentence = 2 + TextRand(6); sentence > 0; sentence--)
+        {
+            TextAppendWords(out, g_TextWordsAscii, IM_ARRAYSIZE(g_TextWordsAscii), 6 + TextRand(14));
+            out->append(". ");
+        }
+        out->append("\n\n");
+    }
+}
+
+struct TextCorpus
+{
+    const char*     Name;
+    void            (*Build)(ImGuiTextBuffer* out);
+};
+
+static const TextCorpus g_TextCorpora[] =
+{
+    { "ascii_log",      BuildCorpusAsciiLog },
+    { "utf8_mixed",     BuildCorpusUtf8Mixed },
+    { "cjk",            BuildCorpusCJK },
+    { "long_line",      BuildCorpusLongLine },
+    { "paragraphs",     BuildCorpusParagraphs },
+};
+
+struct TextCorpusData
+{
+    ImGuiTextBuffer Text;
+    ImVector<int>   BlockOffsets;       // Start of each block of TEXT_BLOCK_LINES lines, plus the end of the text
+    int             CharsCount;
+};
+
+static void BuildTextCorpus(const TextCorpus& corpus, TextCorpusData* out)
+{
+    g_TextRandSeed = 0x12345678;
+    corpus.Build(&out->Text);
+    out->CharsCount = ImTextCountCharsFromUtf8(out->Text.begin(), out->Text.end());
+    out->BlockOffsets.push_back(0);
+    for (int offset = 0, lines = 0; offset < out->Text.size(); offset++)
+        if (out->Text[offset] == '\n' && (++lines % TEXT_BLOCK_LINES) == 0)
+            out->BlockOffsets.push_back(offset + 1);
+    if (out->BlockOffsets.back() < out->Text.size())
+        out->BlockOffsets.push_back(out->Text.size());
+}
+
+enum TextBenchFunc
+{
+    TextBenchFunc_CalcTextSize,         // ImFont::CalcTextSizeA() over the whole corpus
+    TextBenchFunc_CalcWordWrapPosition, // ImFont::CalcWordWrapPositionA() called repeatedly to find every wrapping point of the corpus
+    TextBenchFunc_RenderText            // ImFont::RenderText() for each block of lines, into a 1280x720 clipping rectangle
+};
+
+enum TextBenchFlags
+{
+    TextBenchFlags_None     = 0,
+    TextBenchFlags_Wrap     = 1 << 0,   // Wrap at TEXT_WRAP_WIDTH
+    TextBenchFlags_FineClip = 1 << 1    // Enable cpu_fine_clip in RenderText()
+};
+
+struct TextBench
+{
+    const char*     Name;
+    TextBenchFunc   Func;
+    int             Flags;
+};
+
+static const TextBench g_TextBenches[] =
+{
+    { "CalcTextSizeA",              TextBenchFunc_CalcTextSize,         TextBenchFlags_None },
+    { "CalcTextSizeA/wrap",         TextBenchFunc_CalcTextSize,         TextBenchFlags_Wrap },
+    { "CalcWordWrapPositionA",      TextBenchFunc_CalcWordWrapPosition, TextBenchFlags_Wrap },
+    { "RenderText",                 TextBenchFunc_RenderText,           TextBenchFlags_None },
+    { "RenderText/fine_clip",       TextBenchFunc_RenderText,           TextBenchFlags_FineClip },
+    { "RenderText/wrap",            TextBenchFunc_RenderText,           TextBenchFlags_Wrap },
+    { "RenderText/wrap/fine_clip",  TextBenchFunc_RenderText,           TextBenchFlags_Wrap | TextBenchFlags_FineClip },
+};
+
+struct TextBenchResult
+{
+    char            Name[64];           // "<bench>/<corpus>"
+    int             Iterations;
+    double          Time;
+    double          Bytes, Chars;
+    int             Lines;              // Number of lines after wrapping, as measured by CalcTextSizeA() and CalcWordWrapPositionA()
+    double          VtxCount;
+};
+
+// Process the whole corpus repeatedly until 'min_time' has elapsed.
+static void RunTextBench(const TextBench& bench, const TextCorpus& corpus, const TextCorpusData& data, double min_time, TextBenchResult* out)
+{
+    memset(out, 0, sizeof(*out));
+    snprintf(out->Name, IM_ARRAYSIZE(out->Name), "%s/%s", bench.Name, corpus.Name);
+
+    ImFont* font = ImGui::GetFont();
+    const float font_size = font->FontSize;
+    const float wrap_width = (bench.Flags & TextBenchFlags_Wrap) ? TEXT_WRAP_WIDTH : 0.0f;
+    const bool cpu_fine_clip = (bench.Flags & TextBenchFlags_FineClip) != 0;
+    const ImVec4 clip_rect(0.0f, 0.0f, 1280.0f, 720.0f);
+    const ImVec2 pos(-3.5f, -4.0f); // Clip the first line and column so cpu_fine_clip has work to do
+    const char* text_begin = data.Text.begin();
+    const char* text_end = data.Text.end();
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    for (int iteration = -1; iteration < 1 || out->Time < min_time; iteration++)
+    {
+        draw_list._ResetForNewFrame();
+        draw_list.Flags = ImDrawListFlags_AllowVtxOffset;
+        draw_list.PushClipRectFullScreen();
+        draw_list.PushTextureID(font->ContainerAtlas->TexID);
+
+        int lines = 0;
+        const double t0 = GetTimeInSeconds();
+        switch (bench.Func)
+        {
+        case TextBenchFunc_CalcTextSize:
+            lines = (int)(font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text_begin, text_end).y / font_size);
+            break;
+        case TextBenchFunc_CalcWordWrapPosition:
+            for (const char* s = text_begin; s < text_end; )
+            {
+                const char* wrap_eol = font->CalcWordWrapPositionA(1.0f, s, text_end, wrap_width);
+                s = (wrap_eol == s) ? s + 1 : wrap_eol;
+                while (s < text_end && ImCharIsBlankA(*s)) // Skip blanks and one line return after the wrapping point, as CalcTextSizeA() does
+                    s++;
+                if (s < text_end && *s == '\n')
+                    s++;
+                lines++;
+            }
+            break;
+        case TextBenchFunc_RenderText:
+            for (int block = 0; block + 1 < data.BlockOffsets.Size; block++)
+                font->RenderText(&draw_list, font_size, pos, IM_COL32_WHITE, clip_rect, text_begin + data.BlockOffsets[block], text_begin + data.BlockOffsets[block + 1], wrap_width, cpu_fine_clip);
+            break;
+        }
+        const double t1 = GetTimeInSeconds();
+        if (iteration < 0) // First iteration grows the buffers, don't measure it
+            continue;
+        out->Time += t1 - t0;
+        out->Iterations++;
+        out->Bytes += (double)data.Text.size();
+        out->Chars += (double)data.CharsCount;
+        out->Lines = lines;
+        out->VtxCount += draw_list.VtxBuffer.Size;
+    }
+}
+
+static void WriteTextBenchResults(FILE* f, const TextBenchResult* results, int results_count, bool json)
+{
+    if (json)
+        fprintf(f, "[\n");
+    else
+        fprintf(f, "bench,iterations,time_ms,mb_per_sec,chars_per_sec,lines,vtx_per_iteration\n");
+    for (int n = 0; n < results_count; n++)
+    {
+        const TextBenchResult& r = results[n];
+        const double inv_time = (r.Time > 0.0) ? 1.0 / r.Time : 0.0;
+        const double inv_iterations = (r.Iterations > 0) ? 1.0 / r.Iterations : 0.0;
+        if (json)
+            fprintf(f, "  { \"bench\": \"%s\", \"iterations\": %d, \"time_ms\": %.4f, \"mb_per_sec\": %.2f, \"chars_per_sec\": %.0f, \"lines\": %d, \"vtx_per_iteration\": %.0f }%s\n",
+                r.Name, r.Iterations, r.Time * inv_iterations * 1000.0, r.Bytes * inv_time / (1024.0 * 1024.0), r.Chars * inv_time, r.Lines, r.VtxCount * inv_iterations, (n + 1 < results_count) ? "," : "");
+        else
+            fprintf(f, "%s,%d,%.4f,%.2f,%.0f,%d,%.0f\n",
+                r.Name, r.Iterations, r.Time * inv_iterations * 1000.0, r.Bytes * inv_time / (1024.0 * 1024.0), r.Chars * inv_time, r.Lines, r.VtxCount * inv_iterations);
+    }
+    if (json)
+        fprintf(f, "]\n");
+}
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+enum BenchPhase
+{
+    BenchPhase_NewFrame,
+    BenchPhase_Submit,
+    BenchPhase_EndFrame,
+    BenchPhase_Render,
+    BenchPhase_Total,
+    BenchPhase_COUNT
+};
+
+static const char* g_PhaseNames[BenchPhase_COUNT] = { "newframe", "submit", "endframe", "render", "total" };
+
+struct BenchResult
+{
+    const char*     SceneName;
+    int             Frames;
+    double          TimeSum[BenchPhase_COUNT];
+    double          TimeMin[BenchPhase_COUNT];
+    double          TimeMax[BenchPhase_COUNT];
+    double          VtxCount, IdxCount, CmdCount, CmdListsCount;
+    double          AllocCount, AllocBytes;
+    double          DamagePct;
+    double          UploadPct;
+};
+
+// Per-frame output when recording or replaying inputs (see '--record' and '--replay')
+struct BenchFrameSample
+{
+    ImU32           DrawDataHash;
+    double          Time[BenchPhase_COUNT];
+    int             VtxCount, IdxCount, CmdCount;
+};
+
+// When 'replay' is set, recorded inputs are used instead of the scripted ones and the number of frames is taken from the recording.
+// When 'out_trace' is set, trace events of the measured frames are appended to it (comma-separated, see ProfilerTraceExport()).
+static void RunScene(const BenchScene& scene, ImFontAtlas* atlas, int frames, int warmup_frames, bool assert_no_alloc, bool flatten_draw_data, bool damage_rects, bool list_hashes, ImGuiInputRecorder* recorder, ImGuiInputReplay* replay, ImVector<BenchFrameSample>* out_samples, ImGuiTextBuffer* out_trace, BenchResult* out)
+{
+    if (replay)
+    {
+        frames = replay->FramesCount;
+        warmup_frames = 0;
+    }
+    memset(out, 0, sizeof(*out));
+    out->SceneName = scene.Name;
+    out->Frames = frames;
+    for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+        out->TimeMin[phase] = 1e+30;
+
+    // Each scene runs in its own context so results don't depend on which scenes ran before.
+    ImGuiContext* ctx = ImGui::CreateContext(atlas);
+    ImGui::SetCurrentContext(ctx);
     ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.ConfigDrawDataFlatten = flatten_draw_data;
+    if (flatten_draw_data)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset; // Like most renderer back-ends, needed to flatten more than 64K vertices with 16-bit indices
+    io.ConfigDrawDataDamageRects = damage_rects;
+    io.ConfigDrawDataListHashes = list_hashes;
+    for (int n = 0; n < ImGuiKey_COUNT; n++)
+        io.KeyMap[n] = n;
+    if (assert_no_alloc)
+        ImGui::DebugStartAllocationAssert(warmup_frames);
+    if (recorder)
+        ImGui::DebugStartInputRecording(recorder);
 
-    // Build atlas
+    for (int frame = 0; frame < warmup_frames + frames; frame++)
+    {
+        if (replay)
+            replay->ApplyNextFrame(&io);
+        else
+            ApplyScriptedInputs(io, frame);
+#ifdef IMGUI_DEBUG_PROFILER
+        if (out_trace && frame == warmup_frames)
+            ImGui::ProfilerTraceStart();
+#endif
+
+        double t[BenchPhase_COUNT + 1];
+        t[0] = GetTimeInSeconds();
+        ImGui::NewFrame();
+        t[1] = GetTimeInSeconds();
+        scene.Func(frame);
+        t[2] = GetTimeInSeconds();
+        ImGui::EndFrame();
+        t[3] = GetTimeInSeconds();
+        ImGui::Render();
+        t[4] = GetTimeInSeconds();
+        if (out_samples)
+        {
+            // Recordings include warm-up frames, so every frame is reported
+            ImDrawData* draw_data = ImGui::GetDrawData();
+            BenchFrameSample sample;
+            sample.DrawDataHash = ImGui::DebugHashDrawData(draw_data);
+            for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+                sample.Time[phase] = (phase == BenchPhase_Total) ? (t[4] - t[0]) : (t[phase + 1] - t[phase]);
+            sample.VtxCount = draw_data->TotalVtxCount;
+            sample.IdxCount = draw_data->TotalIdxCount;
+            sample.CmdCount = 0;
+            for (int n = 0; n < draw_data->CmdListsCount; n++)
+                sample.CmdCount += draw_data->CmdLists[n]->CmdBuffer.Size;
+            out_samples->push_back(sample);
+        }
+        if (frame < warmup_frames)
+            continue;
+        if (out_trace)
+        {
+            // Our own events use the same clock as Dear ImGui's (timestamps are in microseconds)
+            if (!out_trace->empty())
+                out_trace->append(",\n");
+            out_trace->appendf("{\"name\":\"%s\",\"cat\":\"example\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}", scene.Name, t[1] * 1e+6, (t[2] - t[1]) * 1e+6);
+        }
+
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+        {
+            const double dt = (phase == BenchPhase_Total) ? (t[4] - t[0]) : (t[phase + 1] - t[phase]);
+            out->TimeSum[phase] += dt;
+            if (out->TimeMin[phase] > dt) out->TimeMin[phase] = dt;
+            if (out->TimeMax[phase] < dt) out->TimeMax[phase] = dt;
+        }
+
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        out->VtxCount += draw_data->TotalVtxCount;
+        out->IdxCount += draw_data->TotalIdxCount;
+        out->CmdListsCount += draw_data->CmdListsCount;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            out->CmdCount += draw_data->CmdLists[n]->CmdBuffer.Size;
+        out->AllocCount += ctx->MemStatsThisFrame.AllocCount;
+        out->AllocBytes += (double)ctx->MemStatsThisFrame.AllocBytes;
+        double damage_area = 0.0;
+        for (int n = 0; n < draw_data->DamageRectsCount; n++)
+            damage_area += (double)(draw_data->DamageRects[n].z - draw_data->DamageRects[n].x) * (double)(draw_data->DamageRects[n].w - draw_data->DamageRects[n].y);
+        out->DamagePct += damage_area * 100.0 / ((double)draw_data->DisplaySize.x * (double)draw_data->DisplaySize.y);
+        double upload_bytes = 0.0, total_bytes = 0.0;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[n];
+            const double bytes = (double)draw_list->VtxBuffer.Size * sizeof(ImDrawVert) + (double)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx);
+            total_bytes += bytes;
+            if (draw_list->ContentChanged)
+                upload_bytes += bytes;
+        }
+        out->UploadPct += (total_bytes > 0.0) ? upload_bytes * 100.0 / total_bytes : 0.0;
+    }
+
+    if (recorder)
+        ImGui::DebugStopInputRecording();
+#ifdef IMGUI_DEBUG_PROFILER
+    if (out_trace)
+    {
+        ImGui::ProfilerTraceStop();
+        if (!out_trace->empty())
+            out_trace->append(",\n");
+        ImGui::ProfilerTraceExport(out_trace);
+    }
+#endif
+    if (scene.Shutdown)
+        scene.Shutdown();
+    ImGui::DestroyContext(ctx);
+}
+
+static void WriteResults(FILE* f, const BenchResult* results, int results_count, bool json)
+{
+    if (json)
+        fprintf(f, "[\n");
+    else
+    {
+        fprintf(f, "scene,frames");
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+            fprintf(f, ",%s_avg_ms,%s_min_ms,%s_max_ms", g_PhaseNames[phase], g_PhaseNames[phase], g_PhaseNames[phase]);
+        fprintf(f, ",vtx_count,idx_count,cmd_count,cmd_lists_count,alloc_count,alloc_bytes,damage_pct,upload_pct\n");
+    }
+
+    for (int n = 0; n < results_count; n++)
+    {
+        const BenchResult& r = results[n];
+        const double inv_frames = (r.Frames > 0) ? 1.0 / r.Frames : 0.0;
+        if (json)
+        {
+            fprintf(f, "  { \"scene\": \"%s\", \"frames\": %d", r.SceneName, r.Frames);
+            for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+                fprintf(f, ", \"%s_avg_ms\": %.4f, \"%s_min_ms\": %.4f, \"%s_max_ms\": %.4f", g_PhaseNames[phase], r.TimeSum[phase] * inv_frames * 1000.0, g_PhaseNames[phase], r.TimeMin[phase] * 1000.0, g_PhaseNames[phase], r.TimeMax[phase] * 1000.0);
+            fprintf(f, ", \"vtx_count\": %.0f, \"idx_count\": %.0f, \"cmd_count\": %.0f, \"cmd_lists_count\": %.0f, \"alloc_count\": %.2f, \"alloc_bytes\": %.0f, \"damage_pct\": %.2f, \"upload_pct\": %.2f }%s\n",
+                r.VtxCount * inv_frames, r.IdxCount * inv_frames, r.CmdCount * inv_frames, r.CmdListsCount * inv_frames, r.AllocCount * inv_frames, r.AllocBytes * inv_frames, r.DamagePct * inv_frames, r.UploadPct * inv_frames, (n + 1 < results_count) ? "," : "");
+        }
+        else
+        {
+            fprintf(f, "%s,%d", r.SceneName, r.Frames);
+            for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+                fprintf(f, ",%.4f,%.4f,%.4f", r.TimeSum[phase] * inv_frames * 1000.0, r.TimeMin[phase] * 1000.0, r.TimeMax[phase] * 1000.0);
+            fprintf(f, ",%.0f,%.0f,%.0f,%.0f,%.2f,%.0f,%.2f,%.2f\n", r.VtxCount * inv_frames, r.IdxCount * inv_frames, r.CmdCount * inv_frames, r.CmdListsCount * inv_frames, r.AllocCount * inv_frames, r.AllocBytes * inv_frames, r.DamagePct * inv_frames, r.UploadPct * inv_frames);
+        }
+    }
+
+    if (json)
+        fprintf(f, "]\n");
+}
+
+enum BenchMode
+{
+    BenchMode_Frames,
+    BenchMode_DrawList,
+    BenchMode_FontAtlas,
+    BenchMode_Text,
+    BenchMode_Check
+};
+
+static void WriteFrameSamples(FILE* f, const char* scene_name, const ImVector<BenchFrameSample>& samples, bool json)
+{
+    if (json)
+        fprintf(f, "[\n");
+    else
+    {
+        fprintf(f, "scene,frame,draw_data_hash");
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+            fprintf(f, ",%s_ms", g_PhaseNames[phase]);
+        fprintf(f, ",vtx_count,idx_count,cmd_count\n");
+    }
+
+    for (int n = 0; n < samples.Size; n++)
+    {
+        const BenchFrameSample& sample = samples[n];
+        if (json)
+        {
+            fprintf(f, "  { \"scene\": \"%s\", \"frame\": %d, \"draw_data_hash\": \"%08X\"", scene_name, n, sample.DrawDataHash);
+            for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+                fprintf(f, ", \"%s_ms\": %.4f", g_PhaseNames[phase], sample.Time[phase] * 1000.0);
+            fprintf(f, ", \"vtx_count\": %d, \"idx_count\": %d, \"cmd_count\": %d }%s\n", sample.VtxCount, sample.IdxCount, sample.CmdCount, (n + 1 < samples.Size) ? "," : "");
+        }
+        else
+        {
+            fprintf(f, "%s,%d,%08X", scene_name, n, sample.DrawDataHash);
+            for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+                fprintf(f, ",%.4f", sample.Time[phase] * 1000.0);
+            fprintf(f, ",%d,%d,%d\n", sample.VtxCount, sample.IdxCount, sample.CmdCount);
+        }
+    }
+
+    if (json)
+        fprintf(f, "]\n");
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+
+    // Parse command-line
+    const char* scene_filter = NULL;
+    const char* output_filename = NULL;
+    const char* fonts_dir = "../../misc/fonts";
+    const char* font_filename = NULL;
+    const char* record_filename = NULL;
+    const char* replay_filename = NULL;
+    const char* trace_filename = NULL;
+    int frames = 300;
+    int warmup_frames = 10;
+    int bench_ms = 200;
+    bool json = false;
+    bool assert_no_alloc = false;
+    bool flatten_draw_data = false;
+    bool damage_rects = false;
+    bool list_hashes = false;
+    BenchMode mode = BenchMode_Frames;
+    bool list = false;
+    for (int n = 1; n < argc; n++)
+    {
+        const char* arg = argv[n];
+        const char* value = (n + 1 < argc) ? argv[n + 1] : NULL;
+        if (strcmp(arg, "--list") == 0)
+        {
+            list = true;
+            continue;
+        }
+        if (value == NULL)
+        {
+            fprintf(stderr, "Usage: %s [--mode frames|drawlist|fontatlas|text|check] [--scene <name>] [--frames <count>] [--warmup <count>] [--bench-ms <milliseconds>] [--fonts-dir <path>] [--font-file <filename>] [--format csv|json] [--output <filename>] [--assert-no-alloc 0|1] [--flatten-draw-data 0|1] [--damage-rects 0|1] [--list-hashes 0|1] [--record <filename>] [--replay <filename>] [--trace <filename>] [--list]\n", argv[0]);
+            return 1;
+        }
+        if (strcmp(arg, "--mode") == 0)
+        {
+            if (strcmp(value, "frames") == 0)           { mode = BenchMode_Frames; }
+            else if (strcmp(value, "drawlist") == 0)    { mode = BenchMode_DrawList; }
+            else if (strcmp(value, "fontatlas") == 0)   { mode = BenchMode_FontAtlas; }
+            else if (strcmp(value, "text") == 0)        { mode = BenchMode_Text; }
+            else if (strcmp(value, "check") == 0)       { mode = BenchMode_Check; }
+            else { fprintf(stderr, "Unknown mode '%s'\n", value); return 1; }
+        }
+        else if (strcmp(arg, "--scene") == 0)   { scene_filter = value; }
+        else if (strcmp(arg, "--frames") == 0)  { frames = atoi(value); }
+        else if (strcmp(arg, "--warmup") == 0)  { warmup_frames = atoi(value); }
+        else if (strcmp(arg, "--bench-ms") == 0){ bench_ms = atoi(value); }
+        else if (strcmp(arg, "--fonts-dir") == 0)   { fonts_dir = value; }
+        else if (strcmp(arg, "--font-file") == 0)   { font_filename = value; }
+        else if (strcmp(arg, "--record") == 0)  { record_filename = value; }
+        else if (strcmp(arg, "--replay") == 0)  { replay_filename = value; }
+        else if (strcmp(arg, "--trace") == 0)   { trace_filename = value; }
+        else if (strcmp(arg, "--format") == 0)  { json = (strcmp(value, "json") == 0); }
+        else if (strcmp(arg, "--output") == 0)  { output_filename = value; }
+        else if (strcmp(arg, "--assert-no-alloc") == 0) { assert_no_alloc = (atoi(value) != 0); }
+        else if (strcmp(arg, "--flatten-draw-data") == 0) { flatten_draw_data = (atoi(value) != 0); }
+        else if (strcmp(arg, "--damage-rects") == 0) { damage_rects = (atoi(value) != 0); }
+        else if (strcmp(arg, "--list-hashes") == 0) { list_hashes = (atoi(value) != 0); }
+        else { fprintf(stderr, "Unknown argument '%s'\n", arg); return 1; }
+        n++;
+    }
+    if (list)
+    {
+        if (mode == BenchMode_DrawList)
+            for (int n = 0; n < IM_ARRAYSIZE(g_DrawBenches); n++)
+                printf("%s\n", g_DrawBenches[n].Name);
+        else if (mode == BenchMode_FontAtlas)
+            for (int n = 0; n < IM_ARRAYSIZE(g_FontAtlasBenches); n++)
+                printf("%s\n", g_FontAtlasBenches[n].Name);
+        else if (mode == BenchMode_Text)
+            for (int n = 0; n < IM_ARRAYSIZE(g_TextBenches); n++)
+                for (int corpus_n = 0; corpus_n < IM_ARRAYSIZE(g_TextCorpora); corpus_n++)
+                    printf("%s/%s\n", g_TextBenches[n].Name, g_TextCorpora[corpus_n].Name);
+        else if (mode == BenchMode_Check)
+            for (int n = 0; n < IM_ARRAYSIZE(g_DrawChecks); n++)
+                printf("%s\n", g_DrawChecks[n].Name);
+        else
+            for (int n = 0; n < IM_ARRAYSIZE(g_Scenes); n++)
+                printf("%s\n", g_Scenes[n].Name);
+        return 0;
+    }
+    if ((record_filename || replay_filename) && (mode != BenchMode_Frames || scene_filter == NULL))
+    {
+        fprintf(stderr, "--record and --replay require '--mode frames' and a --scene.\n");
+        return 1;
+    }
+#ifdef IMGUI_DEBUG_PROFILER
+    if (trace_filename && mode != BenchMode_Frames)
+    {
+        fprintf(stderr, "--trace requires '--mode frames'.\n");
+        return 1;
+    }
+#else
+    if (trace_filename)
+    {
+        fprintf(stderr, "--trace requires '#define IMGUI_DEBUG_PROFILER'.\n");
+        return 1;
+    }
+#endif
+
+    // Load font files
+    if (mode == BenchMode_FontAtlas)
+        for (int n = 0; n < IM_ARRAYSIZE(g_FontFiles); n++)
+        {
+            char filename[512];
+            snprintf(filename, IM_ARRAYSIZE(filename), "%s/%s", fonts_dir, g_FontFiles[n]);
+            if (!LoadFontFile(filename, &g_FontFilesData[n]))
+            {
+                fprintf(stderr, "Could not load '%s', use --fonts-dir to point to the misc/fonts directory.\n", filename);
+                return 1;
+            }
+        }
+    FontFileData& extra_font_file = g_FontFilesData[IM_ARRAYSIZE(g_FontFiles)];
+    if (font_filename && !LoadFontFile(font_filename, &extra_font_file))
+    {
+        fprintf(stderr, "Could not load '%s'.\n", font_filename);
+        return 1;
+    }
+
+    // Build atlas (shared by the contexts created for each scene)
+    // Text benchmarks merge the glyphs of '--font-file' into the default font.
+    ImFontAtlas atlas;
+    if (mode == BenchMode_Text && font_filename)
+    {
+        atlas.AddFontDefault();
+        ImFontConfig cfg;
+        cfg.MergeMode = true;
+        cfg.FontDataOwnedByAtlas = false;
+        atlas.AddFontFromMemoryTTF(extra_font_file.Data, extra_font_file.Size, 13.0f, &cfg, atlas.GetGlyphRangesChineseFull());
+    }
     unsigned char* tex_pixels = NULL;
     int tex_w, tex_h;
-    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    atlas.GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
 
-    for (int n = 0; n < 20; n++)
+    // Run scenes, ImDrawList, font atlas or text benchmarks
+    BenchResult results[IM_ARRAYSIZE(g_Scenes)];
+    DrawBenchResult drawlist_results[IM_ARRAYSIZE(g_DrawBenches)];
+    DrawCheckResult check_results[IM_ARRAYSIZE(g_DrawChecks)];
+    FontAtlasBenchResult fontatlas_results[IM_ARRAYSIZE(g_FontAtlasBenches)];
+    TextBenchResult text_results[IM_ARRAYSIZE(g_TextBenches) * IM_ARRAYSIZE(g_TextCorpora)];
+    ImVector<BenchFrameSample> frame_samples;
+    int results_count = 0;
+    if (mode == BenchMode_DrawList || mode == BenchMode_Text || mode == BenchMode_Check)
     {
-        printf("NewFrame() %d\n", n);
-        io.DisplaySize = ImVec2(1920, 1080);
-        io.DeltaTime = 1.0f / 60.0f;
+        // Benchmarks and checks use the context shared data (font, tessellation settings), which is set up by NewFrame().
+        ImGuiContext* ctx = ImGui::CreateContext(&atlas);
+        ImGui::GetIO().DisplaySize = ImVec2(1920, 1080);
+        ImGui::GetIO().IniFilename = NULL;
         ImGui::NewFrame();
-
-        static float f = 0.0f;
-        ImGui::Text("Hello, world!");
-        ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
-        ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
-        ImGui::ShowDemoWindow(NULL);
-
-        ImGui::Render();
+        if (mode == BenchMode_DrawList)
+        {
+            for (int n = 0; n < IM_ARRAYSIZE(g_DrawBenches); n++)
+                if (scene_filter == NULL || strncmp(scene_filter, g_DrawBenches[n].Name, strlen(scene_filter)) == 0)
+                    RunDrawBench(g_DrawBenches[n], bench_ms * 0.001, &drawlist_results[results_count++]);
+        }
+        else if (mode == BenchMode_Check)
+        {
+            for (int n = 0; n < IM_ARRAYSIZE(g_DrawChecks); n++)
+                if (scene_filter == NULL || strncmp(scene_filter, g_DrawChecks[n].Name, strlen(scene_filter)) == 0)
+                    RunDrawCheck(g_DrawChecks[n], &check_results[results_count++]);
+        }
+        else
+        {
+            TextCorpusData text_corpora[IM_ARRAYSIZE(g_TextCorpora)];
+            for (int corpus_n = 0; corpus_n < IM_ARRAYSIZE(g_TextCorpora); corpus_n++)
+                BuildTextCorpus(g_TextCorpora[corpus_n], &text_corpora[corpus_n]);
+            for (int n = 0; n < IM_ARRAYSIZE(g_TextBenches); n++)
+                for (int corpus_n = 0; corpus_n < IM_ARRAYSIZE(g_TextCorpora); corpus_n++)
+                {
+                    char name[64];
+                    snprintf(name, IM_ARRAYSIZE(name), "%s/%s", g_TextBenches[n].Name, g_TextCorpora[corpus_n].Name);
+                    if (scene_filter == NULL || strncmp(scene_filter, name, strlen(scene_filter)) == 0)
+                        RunTextBench(g_TextBenches[n], g_TextCorpora[corpus_n], text_corpora[corpus_n], bench_ms * 0.001, &text_results[results_count++]);
+                }
+        }
+        ImGui::EndFrame();
+        ImGui::DestroyContext(ctx);
+    }
+    else if (mode == BenchMode_FontAtlas)
+    {
+        // The context is only used to collect profiler timings
+        ImGuiContext* ctx = ImGui::CreateContext(&atlas);
+        for (int n = 0; n < IM_ARRAYSIZE(g_FontAtlasBenches); n++)
+            if (scene_filter == NULL || strncmp(scene_filter, g_FontAtlasBenches[n].Name, strlen(scene_filter)) == 0)
+                RunFontAtlasBench(g_FontAtlasBenches[n], bench_ms * 0.001, &fontatlas_results[results_count++]);
+        ImGui::DestroyContext(ctx);
+    }
+    else
+    {
+        ImGuiInputRecorder recorder;
+        ImGuiInputReplay replay;
+        ImGuiTextBuffer trace;
+        if (replay_filename && !replay.LoadFromFile(replay_filename))
+        {
+            fprintf(stderr, "Could not load recording '%s'.\n", replay_filename);
+            return 1;
+        }
+        for (int n = 0; n < IM_ARRAYSIZE(g_Scenes); n++)
+            if (scene_filter == NULL || strcmp(scene_filter, g_Scenes[n].Name) == 0)
+                RunScene(g_Scenes[n], &atlas, frames, warmup_frames, assert_no_alloc, flatten_draw_data, damage_rects, list_hashes, record_filename ? &recorder : NULL, replay_filename ? &replay : NULL,
+                    (record_filename || replay_filename) ? &frame_samples : NULL, trace_filename ? &trace : NULL, &results[results_count++]);
+        if (record_filename && !recorder.SaveToFile(record_filename))
+        {
+            fprintf(stderr, "Could not save recording '%s'.\n", record_filename);
+            return 1;
+        }
+        FILE* trace_f = trace_filename ? fopen(trace_filename, "wb") : NULL;
+        if (trace_filename && trace_f == NULL)
+        {
+            fprintf(stderr, "Could not open '%s' for writing.\n", trace_filename);
+            return 1;
+        }
+        if (trace_f)
+        {
+            fprintf(trace_f, "{\"traceEvents\":[\n%s\n],\"displayTimeUnit\":\"ms\"}\n", trace.c_str());
+            fclose(trace_f);
+        }
+    }
+    if (results_count == 0)
+    {
+        fprintf(stderr, "Unknown scene '%s', use --list to list available scenes.\n", scene_filter);
+        return 1;
     }
 
-    printf("DestroyContext()\n");
-    ImGui::DestroyContext();
+    // Report
+    FILE* f = output_filename ? fopen(output_filename, "wb") : stdout;
+    if (f == NULL)
+    {
+        fprintf(stderr, "Could not open '%s' for writing.\n", output_filename);
+        return 1;
+    }
+    if (mode == BenchMode_DrawList)
+        WriteDrawBenchResults(f, drawlist_results, results_count, json);
+    else if (mode == BenchMode_FontAtlas)
+        WriteFontAtlasBenchResults(f, fontatlas_results, results_count, json);
+    else if (mode == BenchMode_Text)
+        WriteTextBenchResults(f, text_results, results_count, json);
+    else if (mode == BenchMode_Check)
+        WriteDrawCheckResults(f, check_results, results_count, json);
+    else if (record_filename || replay_filename)
+        WriteFrameSamples(f, scene_filter, frame_samples, json);
+    else
+        WriteResults(f, results, results_count, json);
+    if (f != stdout)
+        fclose(f);
+    for (int n = 0; n < IM_ARRAYSIZE(g_FontFilesData); n++)
+        free(g_FontFilesData[n].Data);
+    if (mode == BenchMode_Check)
+        for (int n = 0; n < results_count; n++)
+            if (!check_results[n].Passed)
+                return 1;
     return 0;
 }
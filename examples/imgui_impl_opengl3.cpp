@@ -6,6 +6,8 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Desktop GL only: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Support for compact vertices (IMGUI_USE_COMPACT_DRAWVERT).
+//  [X] Renderer: Keep unchanged draw lists on the GPU instead of uploading them every frame (io.ConfigDrawDataListHashes).
 
 // You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
 // If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
@@ -13,6 +15,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2020-10-12: OpenGL: Draw lists with a content hash (io.ConfigDrawDataListHashes) use their own vertex/index buffers, only uploaded when the hash changes.
+//  2020-09-28: OpenGL: Added support for compact vertices (IMGUI_USE_COMPACT_DRAWVERT): 16-bit positions/uv attributes, position scale folded into the projection matrix.
 //  2020-07-10: OpenGL: Added support for glad2 OpenGL loader.
 //  2020-05-08: OpenGL: Made default GLSL version 150 (instead of 130) on OSX.
 //  2020-04-21: OpenGL: Fixed handling of glClipControl(GL_UPPER_LEFT) by inverting projection matrix.
@@ -139,6 +143,21 @@ static GLint        g_AttribLocationTex = 0, g_AttribLocationProjMtx = 0;
 static GLuint       g_AttribLocationVtxPos = 0, g_AttribLocationVtxUV = 0, g_AttribLocationVtxColor = 0; // Vertex attributes location
 static unsigned int g_VboHandle = 0, g_ElementsHandle = 0;
 
+// Vertex/index buffers of a draw list with a content hash (io.ConfigDrawDataListHashes), uploaded again only when the hash or the buffer sizes change.
+// (the 32-bit hash alone may collide, comparing the sizes as well makes reusing stale geometry much less likely)
+// Buffers of draw lists which haven't been rendered for a while are destroyed (several ImDrawData may be rendered each frame, e.g. one per context).
+struct ImGui_ImplOpenGL3_DrawListBuffers
+{
+    const ImDrawList*   DrawList;
+    ImU32               ContentHash;
+    int                 VtxCount, IdxCount;
+    GLuint              VboHandle, ElementsHandle;
+    int                 LastRenderCount;
+};
+static ImVector<ImGui_ImplOpenGL3_DrawListBuffers> g_DrawListBuffers;
+static int          g_RenderCount = 0;                  // Number of ImGui_ImplOpenGL3_RenderDrawData() calls
+static const int    g_DrawListBuffersMaxUnusedRenders = 60;
+
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 {
@@ -224,6 +243,8 @@ void    ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
+static void ImGui_ImplOpenGL3_SetupVertexBuffers(GLuint vbo_handle, GLuint elements_handle);
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
@@ -253,10 +274,15 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float T = draw_data->DisplayPos.y;
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float S = 1.0f / (1 << IM_DRAWVERT_POS_FRAC_BITS); // Compact vertices store fixed point positions (see ImDrawVertPos16)
+#else
+    const float S = 1.0f;
+#endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
+        { 2.0f*S/(R-L), 0.0f,         0.0f,   0.0f },
+        { 0.0f,         2.0f*S/(T-B), 0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
@@ -272,17 +298,61 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glBindVertexArray(vertex_array_object);
 #endif
 
-    // Bind vertex/index buffers and setup attributes for ImDrawVert
-    glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle);
+    ImGui_ImplOpenGL3_SetupVertexBuffers(g_VboHandle, g_ElementsHandle);
+}
+
+// Bind vertex/index buffers and setup attributes for ImDrawVert
+static void ImGui_ImplOpenGL3_SetupVertexBuffers(GLuint vbo_handle, GLuint elements_handle)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_handle);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elements_handle);
     glEnableVertexAttribArray(g_AttribLocationVtxPos);
     glEnableVertexAttribArray(g_AttribLocationVtxUV);
     glEnableVertexAttribArray(g_AttribLocationVtxColor);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#else
     glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
     glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#endif
     glVertexAttribPointer(g_AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
 }
 
+static ImGui_ImplOpenGL3_DrawListBuffers* ImGui_ImplOpenGL3_GetDrawListBuffers(const ImDrawList* draw_list)
+{
+    // Linear search: there is typically one draw list per visible window
+    for (int n = 0; n < g_DrawListBuffers.Size; n++)
+        if (g_DrawListBuffers[n].DrawList == draw_list)
+            return &g_DrawListBuffers[n];
+    ImGui_ImplOpenGL3_DrawListBuffers buffers;
+    buffers.DrawList = draw_list;
+    buffers.ContentHash = 0;
+    buffers.VtxCount = buffers.IdxCount = -1;
+    buffers.LastRenderCount = g_RenderCount;
+    glGenBuffers(1, &buffers.VboHandle);
+    glGenBuffers(1, &buffers.ElementsHandle);
+    g_DrawListBuffers.push_back(buffers);
+    return &g_DrawListBuffers.back();
+}
+
+static void ImGui_ImplOpenGL3_DestroyDrawListBuffers(bool unused_only)
+{
+    int n_out = 0;
+    for (int n = 0; n < g_DrawListBuffers.Size; n++)
+    {
+        ImGui_ImplOpenGL3_DrawListBuffers& buffers = g_DrawListBuffers[n];
+        if (unused_only && g_RenderCount - buffers.LastRenderCount < g_DrawListBuffersMaxUnusedRenders)
+        {
+            g_DrawListBuffers[n_out++] = buffers;
+            continue;
+        }
+        glDeleteBuffers(1, &buffers.VboHandle);
+        glDeleteBuffers(1, &buffers.ElementsHandle);
+    }
+    g_DrawListBuffers.resize(n_out);
+}
+
 // OpenGL3 Render function.
 // (this used to be set in io.RenderDrawListsFn and called by ImGui::Render(), but you can now call this directly from your main loop)
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly, in order to be able to run within any OpenGL engine that doesn't do so.
@@ -336,13 +406,39 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
     // Render command lists
+    g_RenderCount++;
+    GLuint bound_vbo_handle = g_VboHandle;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
 
         // Upload vertex/index buffers
-        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+        // Draw lists with a content hash (io.ConfigDrawDataListHashes) keep their own buffers and skip the upload when unchanged.
+        GLuint vbo_handle = g_VboHandle, elements_handle = g_ElementsHandle;
+        GLenum usage = GL_STREAM_DRAW;
+        bool upload = true;
+        if (cmd_list->ContentHash != 0)
+        {
+            ImGui_ImplOpenGL3_DrawListBuffers* buffers = ImGui_ImplOpenGL3_GetDrawListBuffers(cmd_list);
+            upload = (buffers->ContentHash != cmd_list->ContentHash || buffers->VtxCount != cmd_list->VtxBuffer.Size || buffers->IdxCount != cmd_list->IdxBuffer.Size);
+            buffers->ContentHash = cmd_list->ContentHash;
+            buffers->VtxCount = cmd_list->VtxBuffer.Size;
+            buffers->IdxCount = cmd_list->IdxBuffer.Size;
+            buffers->LastRenderCount = g_RenderCount;
+            vbo_handle = buffers->VboHandle;
+            elements_handle = buffers->ElementsHandle;
+            usage = GL_DYNAMIC_DRAW;
+        }
+        if (vbo_handle != bound_vbo_handle)
+        {
+            ImGui_ImplOpenGL3_SetupVertexBuffers(vbo_handle, elements_handle);
+            bound_vbo_handle = vbo_handle;
+        }
+        if (upload)
+        {
+            glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, usage);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, usage);
+        }
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -352,7 +448,11 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    if (vbo_handle != g_VboHandle)
+                        ImGui_ImplOpenGL3_SetupVertexBuffers(vbo_handle, elements_handle);
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -383,10 +483,11 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         }
     }
 
-    // Destroy the temporary VAO
+    // Destroy the temporary VAO, and the buffers of draw lists which haven't been rendered for a while
 #ifndef IMGUI_IMPL_OPENGL_ES2
     glDeleteVertexArrays(1, &vertex_array_object);
 #endif
+    ImGui_ImplOpenGL3_DestroyDrawListBuffers(true);
 
     // Restore modified GL state
     glUseProgram(last_program);
@@ -672,6 +773,8 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
 {
     if (g_VboHandle)        { glDeleteBuffers(1, &g_VboHandle); g_VboHandle = 0; }
     if (g_ElementsHandle)   { glDeleteBuffers(1, &g_ElementsHandle); g_ElementsHandle = 0; }
+    ImGui_ImplOpenGL3_DestroyDrawListBuffers(false);
+    g_DrawListBuffers.clear();
     if (g_ShaderHandle && g_VertHandle) { glDetachShader(g_ShaderHandle, g_VertHandle); }
     if (g_ShaderHandle && g_FragHandle) { glDetachShader(g_ShaderHandle, g_FragHandle); }
     if (g_VertHandle)       { glDeleteShader(g_VertHandle); g_VertHandle = 0; }
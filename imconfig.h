@@ -52,6 +52,9 @@
 //---- Use 32-bit for ImWchar (default is 16-bit) to support full unicode code points.
 //#define IMGUI_USE_WCHAR32
 
+//---- Don't use SSE2/NEON intrinsics to tessellate anti-aliased lines, use the scalar code instead (both output the same geometry up to float rounding).
+//#define IMGUI_DISABLE_SIMD
+
 //---- Avoid multiple STB libraries implementations, or redefine path/filenames to prioritize another version
 // By default the embedded implementations are declared static and not available outside of imgui cpp files.
 //#define IMGUI_STB_TRUETYPE_FILENAME   "my_folder/stb_truetype.h"
@@ -81,6 +84,10 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert (default is 20 bytes): 16-bit fixed point positions (1/8 pixel precision, within [-4096,+4096)) and 16-bit normalized UV.
+// Your renderer back-end will need to support it (the OpenGL3 and Vulkan back-ends do). See ImDrawVertPos16/ImDrawVertUV16 in imgui.h for details.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer back-ends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -100,6 +107,14 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Record timings of NewFrame()/Begin()/End()/EndFrame()/Render() phases into a rolling history,
+// (query with GetProfilerPhaseTime() or browse with 'Metrics->Profiler', which can also capture a Chrome trace.) This adds a timer query per instrumented scope.
+//#define IMGUI_DEBUG_PROFILER
+
+//---- Debug Tools: Attribute heap allocations to call-sites (ImDrawList, ImGuiStorage, ImGuiTextBuffer, InputText, Settings),
+// (browse with 'Metrics->Allocations'.) Per-frame allocation counters and the warm-up assert (g.DebugAllocAssertAfterFrame) are always available.
+//#define IMGUI_DEBUG_ALLOCATIONS
+
 //---- Tip: You can add extra functions within the ImGui:: namespace, here or in your own headers files.
 /*
 namespace ImGui
@@ -76,6 +76,8 @@ CODE
 // [SECTION] LOGGING/CAPTURING
 // [SECTION] SETTINGS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] INPUT RECORDING
+// [SECTION] PROFILER
 // [SECTION] METRICS/DEBUG WINDOW
 
 */
@@ -727,6 +729,9 @@ CODE
 #else
 #include <stdint.h>     // intptr_t
 #endif
+#ifdef IMGUI_DEBUG_PROFILER
+#include <time.h>       // clock_gettime, clock
+#endif
 
 // [Windows] OS specific includes (optional)
 #if defined(_WIN32) && defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && defined(IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS) && defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
@@ -863,10 +868,16 @@ static void             UpdateMouseInputs();
 static void             UpdateMouseWheel();
 static void             UpdateTabFocus();
 static void             UpdateDebugToolItemPicker();
+#ifdef IMGUI_DEBUG_PROFILER
+static void             ProfilerNewFrame();
+#endif
 static bool             UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
 static void             RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& title_bar_rect, const char* name, bool* p_open);
+static bool             IsWindowContentsIdle(ImGuiWindow* window);
+static ImGuiID          CalcWindowContentsHash(ImGuiWindow* window, bool title_bar_is_highlight, const ImU32 resize_grip_col[4], int resize_grip_count);
+static void             KeepAliveChildWindows(ImGuiWindow* window);
 
 }
 
@@ -949,6 +960,7 @@ ImGuiStyle::ImGuiStyle()
     AntiAliasedLines        = true;             // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU.
     AntiAliasedLinesUseTex  = true;             // Enable anti-aliased lines/borders using textures where possible. Require back-end to render with bilinear filtering.
     AntiAliasedFill         = true;             // Enable anti-aliased filled shapes (rounded rectangles, circles, etc.).
+    AntiAliasedRoundCornersUseTex = true;       // Enable anti-aliased rounded rectangles and circles using textures where possible. Require back-end to render with bilinear filtering.
     CurveTessellationTol    = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     CircleSegmentMaxError   = 1.60f;            // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
 
@@ -1024,6 +1036,9 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsMemoryCompactTimer = 60.0f;
+    ConfigDrawDataFlatten = false;
+    ConfigDrawDataDamageRects = false;
+    ConfigDrawDataListHashes = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1883,7 +1898,10 @@ int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
+    {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Storage);
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    }
     return &it->val_i;
 }
 
@@ -1896,7 +1914,10 @@ float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
+    {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Storage);
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    }
     return &it->val_f;
 }
 
@@ -1904,7 +1925,10 @@ void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
+    {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Storage);
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    }
     return &it->val_p;
 }
 
@@ -1914,6 +1938,7 @@ void ImGuiStorage::SetInt(ImGuiID key, int val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Storage);
         Data.insert(it, ImGuiStoragePair(key, val));
         return;
     }
@@ -1930,6 +1955,7 @@ void ImGuiStorage::SetFloat(ImGuiID key, float val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Storage);
         Data.insert(it, ImGuiStoragePair(key, val));
         return;
     }
@@ -1941,6 +1967,7 @@ void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Storage);
         Data.insert(it, ImGuiStoragePair(key, val));
         return;
     }
@@ -2080,6 +2107,7 @@ void ImGuiTextBuffer::append(const char* str, const char* str_end)
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_TextBuffer);
         int new_capacity = Buf.Capacity * 2;
         Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
     }
@@ -2115,6 +2143,7 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_TextBuffer);
         int new_capacity = Buf.Capacity * 2;
         Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
     }
@@ -2762,6 +2791,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     Hidden = false;
     IsFallbackWindow = false;
     HasCloseButton = false;
+    ContentsReused = false;
     ResizeBorderHeld = -1;
     BeginCount = 0;
     BeginOrderWithinParent = -1;
@@ -2774,6 +2804,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     HiddenFramesCanSkipItems = HiddenFramesCannotSkipItems = 0;
     SetWindowPosAllowFlags = SetWindowSizeAllowFlags = SetWindowCollapsedAllowFlags = ImGuiCond_Always | ImGuiCond_Once | ImGuiCond_FirstUseEver | ImGuiCond_Appearing;
     SetWindowPosVal = SetWindowPosPivot = ImVec2(FLT_MAX, FLT_MAX);
+    ContentsHash = 0;
 
     InnerRect = ImRect(0.0f, 0.0f, 0.0f, 0.0f); // Clear so the InnerRect.GetSize() code in Begin() doesn't lead to overflow even if the result isn't used.
 
@@ -2796,6 +2827,11 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
 
     MemoryCompacted = false;
     MemoryDrawListIdxCapacity = MemoryDrawListVtxCapacity = 0;
+
+#ifdef IMGUI_DEBUG_PROFILER
+    ProfilerTimeBegin = ProfilerTimeTotal = 0.0f;
+    ProfilerTimeBeginAccum = ProfilerTimeTotalAccum = 0.0f;
+#endif
 }
 
 ImGuiWindow::~ImGuiWindow()
@@ -3191,11 +3227,34 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+// Allocation counters and tags are not synchronized, so only the thread which last called CreateContext()/NewFrame() updates them.
+// Allocations made on other threads (e.g. ImDrawList filled by worker threads) are not counted, as if no context was current.
+// Pointers aren't tracked, so io.MetricsActiveAllocations drifts when a buffer is allocated and freed on different threads.
+// The per-frame MemStatsThisFrame counters and DebugStartAllocationAssert() are not affected.
+#ifdef IM_THREAD_LOCAL
+static IM_THREAD_LOCAL char GImMemThreadMarker;    // Its address identifies the calling thread
+static const void*      GetMemThreadId()           { return &GImMemThreadMarker; }
+#else
+static const void*      GetMemThreadId()           { return NULL; }
+#endif
+static ImGuiContext*    GetMemTrackingContext()    { ImGuiContext* ctx = GImGui; return (ctx && ctx->MemThreadId == GetMemThreadId()) ? ctx : NULL; }
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
-    if (ImGuiContext* ctx = GImGui)
+    if (ImGuiContext* ctx = GetMemTrackingContext())
+    {
         ctx->IO.MetricsActiveAllocations++;
+        ctx->MemStatsThisFrame.AllocCount++;
+        ctx->MemStatsThisFrame.AllocBytes += size;
+#ifdef IMGUI_DEBUG_ALLOCATIONS
+        ctx->MemStatsThisFrame.TagAllocCount[ctx->MemTagCurrent]++;
+        ctx->MemStatsThisFrame.TagAllocBytes[ctx->MemTagCurrent] += size;
+#endif
+        // Steady state allocation check. If you hit this assert: a heap allocation happened after the warm-up frames set with DebugStartAllocationAssert().
+        // Look at the call-stack to find which buffer is growing. Reserving ahead or keeping buffers alive across frames are the usual fixes.
+        IM_ASSERT((ctx->DebugAllocAssertAfterFrame < 0 || ctx->FrameCount <= ctx->DebugAllocAssertAfterFrame) && "Heap allocation after warm-up!");
+    }
     return GImAllocatorAllocFunc(size, GImAllocatorUserData);
 }
 
@@ -3203,11 +3262,30 @@ void* ImGui::MemAlloc(size_t size)
 void ImGui::MemFree(void* ptr)
 {
     if (ptr)
-        if (ImGuiContext* ctx = GImGui)
+        if (ImGuiContext* ctx = GetMemTrackingContext())
+        {
             ctx->IO.MetricsActiveAllocations--;
+            ctx->MemStatsThisFrame.FreeCount++;
+        }
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
+#ifdef IMGUI_DEBUG_ALLOCATIONS
+ImGuiMemTagScope::ImGuiMemTagScope(ImGuiMemTag tag)
+{
+    ImGuiContext* ctx = GetMemTrackingContext();
+    BackupTag = ctx ? ctx->MemTagCurrent : ImGuiMemTag_Other;
+    if (ctx)
+        ctx->MemTagCurrent = tag;
+}
+
+ImGuiMemTagScope::~ImGuiMemTagScope()
+{
+    if (ImGuiContext* ctx = GetMemTrackingContext())
+        ctx->MemTagCurrent = BackupTag;
+}
+#endif
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3252,6 +3330,7 @@ void ImGui::SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data
 ImGuiContext* ImGui::CreateContext(ImFontAtlas* shared_font_atlas)
 {
     ImGuiContext* ctx = IM_NEW(ImGuiContext)(shared_font_atlas);
+    ctx->MemThreadId = GetMemThreadId();
     if (GImGui == NULL)
         SetCurrentContext(ctx);
     Initialize(ctx);
@@ -3306,6 +3385,27 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+// Copies of the shared draw data, so ImDrawList instances can be filled on other threads while ImGui:: functions modify the original one.
+ImDrawListSharedData* ImGui::CreateDrawListSharedData()
+{
+    ImDrawListSharedData* data = IM_NEW(ImDrawListSharedData)();
+    UpdateDrawListSharedData(data);
+    return data;
+}
+
+void ImGui::UpdateDrawListSharedData(ImDrawListSharedData* data)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(data != &g.DrawListSharedData);
+    *data = g.DrawListSharedData;
+    data->BezierCache = NULL; // Not thread-safe, and belongs to the context
+}
+
+void ImGui::DestroyDrawListSharedData(ImDrawListSharedData* data)
+{
+    IM_DELETE(data);
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -3619,6 +3719,7 @@ void ImGui::UpdateTabFocus()
 void ImGui::UpdateHoveredWindowAndCaptureFlags()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_UpdateHoveredWindow);
 
     // Find the window hovered by mouse:
     // - Child windows can extend beyond the limit of their parent so we need to derive HoveredRootWindow from HoveredWindow.
@@ -3693,6 +3794,11 @@ void ImGui::NewFrame()
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
 
+#ifdef IMGUI_DEBUG_PROFILER
+    ProfilerNewFrame();
+#endif
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_NewFrame);
+
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     ImGuiTestEngineHook_PreNewFrame(&g);
 #endif
@@ -3700,12 +3806,19 @@ void ImGui::NewFrame()
     // Check and assert for various common IO and Configuration mistakes
     ErrorCheckNewFrameSanityChecks();
 
+    // Record inputs (see DebugStartInputRecording())
+    if (g.DebugInputRecorder)
+        g.DebugInputRecorder->RecordFrame(g.IO);
+
     // Load settings on first frame, save settings when modified (after a delay)
     UpdateSettings();
 
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.MemStatsLastFrame = g.MemStatsThisFrame;
+    g.MemStatsThisFrame.Clear();
+    g.MemThreadId = GetMemThreadId();
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -3722,6 +3835,7 @@ void ImGui::NewFrame()
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
     g.DrawListSharedData.CurveTessellationTol = g.Style.CurveTessellationTol;
+    g.DrawListSharedData.BezierCache = &g.DrawListBezierCache;
     g.DrawListSharedData.SetCircleSegmentMaxError(g.Style.CircleSegmentMaxError);
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
@@ -3730,8 +3844,11 @@ void ImGui::NewFrame()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
+    if (g.Style.AntiAliasedRoundCornersUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedRoundCornersUseTex;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    g.DrawListSharedData.InitialFlags |= ImDrawListFlags_CullClipped;
 
     g.BackgroundDrawList._ResetForNewFrame();
     g.BackgroundDrawList.PushTextureID(g.IO.Fonts->TexID);
@@ -3983,6 +4100,10 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.DrawDataBuilder.ClearFreeMemory();
     g.BackgroundDrawList._ClearFreeMemory();
     g.ForegroundDrawList._ClearFreeMemory();
+    g.DrawDataFlattenedList._ClearFreeMemory();
+    g.DrawDataDamageTiles.clear();
+    g.DrawDataDamageTilesPrev.clear();
+    g.DrawDataDamageRects.clear();
 
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
@@ -3990,6 +4111,9 @@ void ImGui::Shutdown(ImGuiContext* context)
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
+#ifdef IMGUI_DEBUG_PROFILER
+    g.ProfilerWindowStartTicks.clear();
+#endif
     g.InputTextState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
@@ -4129,6 +4253,269 @@ static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_da
     }
 }
 
+// Damage rectangles (io.ConfigDrawDataDamageRects)
+// - The display is divided into tiles of IM_DRAWDATA_DAMAGE_TILE_SIZE pixels. Each triangle is hashed with the clip rectangle and texture
+//   of its command, then combined in rendering order into the hash of every tile overlapped by its clipped bounding box. Tiles whose hash
+//   differs from the previous frame are damaged, which catches changes of contents, position and z-order alike.
+//   (comparing hashes of whole ImDrawCmd would damage whole windows, as most of their contents are merged into a few commands)
+// - Callbacks can't be compared, the tiles overlapped by their clip rectangle are always damaged.
+// - Damaged tiles are merged into rectangles: runs of tiles on each row, extended over the following rows when they cover the same columns.
+static inline ImU32 DrawDataDamageHash(ImU32 hash, ImU32 value)
+{
+    return (hash ^ value) * 16777619u; // FNV-1a over 32-bit words
+}
+
+static inline ImU32 DrawDataDamageHashVertex(ImU32 hash, const ImDrawVert* vtx)
+{
+    ImU32 words[sizeof(ImDrawVert) / 4];
+    memcpy(words, vtx, sizeof(words));
+    for (int n = 0; n < IM_ARRAYSIZE(words); n++)
+        hash = DrawDataDamageHash(hash, words[n]);
+    if (sizeof(ImDrawVert) % 4 != 0)
+        hash = ImHashData((const char*)vtx + sizeof(words), sizeof(ImDrawVert) % 4, hash);
+    return hash;
+}
+
+static void DrawDataDamageAddDrawList(const ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    const ImVec4 display_rect = g.DrawDataDamageDisplayRect;
+    const float inv_tile_size = 1.0f / IM_DRAWDATA_DAMAGE_TILE_SIZE;
+    const int tiles_w = (int)ImCeil((display_rect.z - display_rect.x) * inv_tile_size);
+    const int tiles_h = (int)ImCeil((display_rect.w - display_rect.y) * inv_tile_size);
+    ImU32* tiles = g.DrawDataDamageTiles.Data;
+    for (const ImDrawCmd* cmd = draw_list->CmdBuffer.Data; cmd < draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size; cmd++)
+    {
+        const ImVec4 clip(ImMax(cmd->ClipRect.x, display_rect.x), ImMax(cmd->ClipRect.y, display_rect.y), ImMin(cmd->ClipRect.z, display_rect.z), ImMin(cmd->ClipRect.w, display_rect.w));
+        if (clip.x >= clip.z || clip.y >= clip.w || cmd->UserCallback == ImDrawCallback_ResetRenderState)
+            continue;
+        if (cmd->UserCallback != NULL)
+        {
+            const int tx1 = ImMin((int)((clip.z - display_rect.x) * inv_tile_size), tiles_w - 1);
+            const int ty1 = ImMin((int)((clip.w - display_rect.y) * inv_tile_size), tiles_h - 1);
+            for (int ty = (int)((clip.y - display_rect.y) * inv_tile_size); ty <= ty1; ty++)
+                for (int tx = (int)((clip.x - display_rect.x) * inv_tile_size); tx <= tx1; tx++)
+                    tiles[ty * tiles_w + tx] = DrawDataDamageHash(tiles[ty * tiles_w + tx], (ImU32)g.FrameCount);
+            continue;
+        }
+
+        const ImU32 cmd_hash = ImHashData(&cmd->ClipRect, sizeof(ImVec4) + sizeof(ImTextureID)); // Same fields as ImDrawCmd_HeaderCompare() minus VtxOffset
+        const ImDrawVert* vtx = draw_list->VtxBuffer.Data + cmd->VtxOffset;
+        const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd->IdxOffset;
+        for (const ImDrawIdx* idx_end = idx + cmd->ElemCount; idx + 3 <= idx_end; idx += 3)
+        {
+            const ImDrawVert* v0 = &vtx[idx[0]];
+            const ImDrawVert* v1 = &vtx[idx[1]];
+            const ImDrawVert* v2 = &vtx[idx[2]];
+            const ImVec2 p0 = v0->pos, p1 = v1->pos, p2 = v2->pos;
+            const float min_x = ImMax(ImMin(ImMin(p0.x, p1.x), p2.x), clip.x);
+            const float min_y = ImMax(ImMin(ImMin(p0.y, p1.y), p2.y), clip.y);
+            const float max_x = ImMin(ImMax(ImMax(p0.x, p1.x), p2.x), clip.z);
+            const float max_y = ImMin(ImMax(ImMax(p0.y, p1.y), p2.y), clip.w);
+            if (min_x > max_x || min_y > max_y)
+                continue;
+            const ImU32 hash = DrawDataDamageHashVertex(DrawDataDamageHashVertex(DrawDataDamageHashVertex(cmd_hash, v0), v1), v2);
+            const int tx0 = (int)((min_x - display_rect.x) * inv_tile_size);
+            const int tx1 = ImMin((int)((max_x - display_rect.x) * inv_tile_size), tiles_w - 1);
+            const int ty1 = ImMin((int)((max_y - display_rect.y) * inv_tile_size), tiles_h - 1);
+            for (int ty = (int)((min_y - display_rect.y) * inv_tile_size); ty <= ty1; ty++)
+                for (int tx = tx0; tx <= tx1; tx++)
+                    tiles[ty * tiles_w + tx] = DrawDataDamageHash(tiles[ty * tiles_w + tx], hash);
+        }
+    }
+}
+
+static void DrawDataDamageUpdateRects(ImDrawData* draw_data)
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<ImVec4>& rects = g.DrawDataDamageRects;
+    const ImVec4 display_rect = g.DrawDataDamageDisplayRect;
+    rects.reserve(IM_DRAWDATA_DAMAGE_RECTS_MAX + 1); // Gathering stops past IM_DRAWDATA_DAMAGE_RECTS_MAX, so this never grows
+    rects.resize(0);
+    if (g.DrawDataDamageTilesPrev.Size != g.DrawDataDamageTiles.Size)
+    {
+        // First frame or display rectangle changed
+        rects.push_back(display_rect);
+    }
+    else
+    {
+        const float tile_size = (float)IM_DRAWDATA_DAMAGE_TILE_SIZE;
+        const int tiles_w = (int)ImCeil((display_rect.z - display_rect.x) / tile_size);
+        const int tiles_h = (int)ImCeil((display_rect.w - display_rect.y) / tile_size);
+        const ImU32* tiles = g.DrawDataDamageTiles.Data;
+        const ImU32* tiles_prev = g.DrawDataDamageTilesPrev.Data;
+        ImVec4 bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (int ty = 0; ty < tiles_h; ty++)
+            for (int tx = 0; tx < tiles_w; tx++)
+            {
+                if (tiles[ty * tiles_w + tx] == tiles_prev[ty * tiles_w + tx])
+                    continue;
+                int tx_end = tx + 1;
+                while (tx_end < tiles_w && tiles[ty * tiles_w + tx_end] != tiles_prev[ty * tiles_w + tx_end])
+                    tx_end++;
+                const ImVec4 r(display_rect.x + tx * tile_size, display_rect.y + ty * tile_size, ImMin(display_rect.x + tx_end * tile_size, display_rect.z), ImMin(display_rect.y + (ty + 1) * tile_size, display_rect.w));
+                bounds = ImVec4(ImMin(bounds.x, r.x), ImMin(bounds.y, r.y), ImMax(bounds.z, r.z), ImMax(bounds.w, r.w));
+                tx = tx_end;
+
+                // Extend the rectangle covering the same columns on the previous row, if any. Stop gathering past IM_DRAWDATA_DAMAGE_RECTS_MAX.
+                if (rects.Size > IM_DRAWDATA_DAMAGE_RECTS_MAX)
+                    continue;
+                int n = rects.Size - 1;
+                while (n >= 0 && !(rects[n].w == r.y && rects[n].x == r.x && rects[n].z == r.z))
+                    n--;
+                if (n >= 0)
+                    rects[n].w = r.w;
+                else
+                    rects.push_back(r);
+            }
+        if (rects.Size > IM_DRAWDATA_DAMAGE_RECTS_MAX)
+        {
+            rects.resize(1);
+            rects[0] = bounds;
+        }
+    }
+    draw_data->DamageRects = rects.Data;
+    draw_data->DamageRectsCount = rects.Size;
+}
+
+static void UpdateDrawDataDamageRects(ImDrawData* draw_data)
+{
+    ImGuiContext& g = *GImGui;
+    const ImVec4 display_rect(draw_data->DisplayPos.x, draw_data->DisplayPos.y, draw_data->DisplayPos.x + draw_data->DisplaySize.x, draw_data->DisplayPos.y + draw_data->DisplaySize.y);
+    if (!g.IO.ConfigDrawDataDamageRects)
+    {
+        g.DrawDataDamageTiles.resize(0);
+        g.DrawDataDamageTilesPrev.resize(0);
+        g.DrawDataDamageRects.resize(0);
+        g.DrawDataDamageRects.push_back(display_rect);
+        draw_data->DamageRects = g.DrawDataDamageRects.Data;
+        draw_data->DamageRectsCount = g.DrawDataDamageRects.Size;
+        return;
+    }
+
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_DrawDataDamage);
+    g.DrawDataDamageTiles.swap(g.DrawDataDamageTilesPrev);
+    if (memcmp(&display_rect, &g.DrawDataDamageDisplayRect, sizeof(ImVec4)) != 0)
+    {
+        g.DrawDataDamageDisplayRect = display_rect;
+        g.DrawDataDamageTilesPrev.resize(0);
+    }
+    const int tiles_w = ImMax((int)ImCeil(draw_data->DisplaySize.x / IM_DRAWDATA_DAMAGE_TILE_SIZE), 0);
+    const int tiles_h = ImMax((int)ImCeil(draw_data->DisplaySize.y / IM_DRAWDATA_DAMAGE_TILE_SIZE), 0);
+    g.DrawDataDamageTiles.resize(tiles_w * tiles_h);
+    for (int n = 0; n < g.DrawDataDamageTiles.Size; n++)
+        g.DrawDataDamageTiles.Data[n] = 2166136261u; // FNV-1a offset basis
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        DrawDataDamageAddDrawList(draw_data->CmdLists[n]);
+    DrawDataDamageUpdateRects(draw_data);
+}
+
+// Draw list content hashes (io.ConfigDrawDataListHashes)
+// - VtxBuffer and IdxBuffer are hashed as 32-bit words over 4 independent lanes, each mixing words with multiplies and rotations (MurmurHash3 style).
+//   Unlike FNV-1a, changes of the same bits in two words don't cancel each other out, and the lanes don't wait on each other.
+// - Hashes are never 0, which stands for "not computed" in ImDrawList::ContentHash.
+static inline ImU32 DrawListContentHashRotl(ImU32 value, int shift)
+{
+    return (value << shift) | (value >> (32 - shift));
+}
+
+static inline ImU32 DrawListContentHashMix(ImU32 hash, ImU32 value)
+{
+    value = DrawListContentHashRotl(value * 0xCC9E2D51u, 15) * 0x1B873593u;
+    return DrawListContentHashRotl(hash ^ value, 13) * 5 + 0xE6546B64u;
+}
+
+static ImU32 DrawListContentHashData(const void* data, size_t data_size, ImU32 seed)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    const size_t words_count = data_size / 4;
+    ImU32 lanes[4] = { seed, seed + 1, seed + 2, seed + 3 };
+    ImU32 words[4];
+    size_t n = 0;
+    for (; n + 4 <= words_count; n += 4)
+    {
+        memcpy(words, p + n * 4, sizeof(words));
+        lanes[0] = DrawListContentHashMix(lanes[0], words[0]);
+        lanes[1] = DrawListContentHashMix(lanes[1], words[1]);
+        lanes[2] = DrawListContentHashMix(lanes[2], words[2]);
+        lanes[3] = DrawListContentHashMix(lanes[3], words[3]);
+    }
+    for (; n < words_count; n++)
+    {
+        memcpy(words, p + n * 4, 4);
+        lanes[0] = DrawListContentHashMix(lanes[0], words[0]);
+    }
+    ImU32 hash = lanes[0] ^ DrawListContentHashRotl(lanes[1], 7) ^ DrawListContentHashRotl(lanes[2], 14) ^ DrawListContentHashRotl(lanes[3], 21);
+    if (data_size % 4 != 0)
+        hash = ImHashData(p + words_count * 4, data_size % 4, hash);
+
+    // Finalization (fmix32), also folding in the size
+    hash ^= (ImU32)data_size;
+    hash ^= hash >> 16; hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13; hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static void DrawListUpdateContentHash(ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.IO.ConfigDrawDataListHashes)
+    {
+        draw_list->ContentHash = 0;
+        draw_list->ContentChanged = true;
+        return;
+    }
+    ImU32 hash = DrawListContentHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert), 0);
+    hash = DrawListContentHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx), hash);
+    if (hash == 0)
+        hash = 1;
+    draw_list->ContentChanged = (hash != draw_list->ContentHash);
+    draw_list->ContentHash = hash;
+}
+
+static void UpdateDrawDataListHashes(ImDrawData* draw_data)
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.IO.ConfigDrawDataListHashes)
+    {
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            DrawListUpdateContentHash(draw_data->CmdLists[n]); // Reset to 0
+        return;
+    }
+
+    // Draw lists of windows reusing last frame contents (ImGuiWindowFlags_CacheContents) and of their child windows are known to be unchanged, only hash the others
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_DrawDataListHashes);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        draw_data->CmdLists[n]->ContentChanged = true;
+    for (int n = 0; n < g.Windows.Size; n++)
+        if (g.Windows[n]->RootWindow->ContentsReused && g.Windows[n]->DrawList->ContentHash != 0)
+            g.Windows[n]->DrawList->ContentChanged = false;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        if (draw_data->CmdLists[n]->ContentChanged)
+            DrawListUpdateContentHash(draw_data->CmdLists[n]);
+}
+
+// Append a draw list after the ones of Dear ImGui, on the ImDrawData returned by GetDrawData(). Also see ImDrawList::AddDrawList().
+// (defined here and not in imgui_draw.cpp as the ImDrawList* array is owned by the context)
+void ImDrawData::AddDrawList(ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<ImDrawList*>* draw_lists = &g.DrawDataBuilder.Layers[0];
+    IM_ASSERT(this == &g.DrawData && Valid && CmdListsCount == draw_lists->Size && "Call after Render(), on the ImDrawData returned by GetDrawData()");
+    AddDrawListToDrawData(draw_lists, draw_list);
+    CmdLists = draw_lists->Data;
+    CmdListsCount = draw_lists->Size;
+    TotalVtxCount += draw_list->VtxBuffer.Size;
+    TotalIdxCount += draw_list->IdxBuffer.Size;
+    DrawListUpdateContentHash(draw_list);
+    if (g.DrawDataDamageTiles.Size > 0)
+    {
+        DrawDataDamageAddDrawList(draw_list);
+        DrawDataDamageUpdateRects(this);
+    }
+}
+
 // Push a clipping rectangle for both ImGui logic (hit-testing etc.) and low-level ImDrawList rendering.
 // - When using this function it is sane to ensure that float are perfectly rounded to integer values,
 //   so that e.g. (int)(max.x-min.x) in user's render produce correct result.
@@ -4159,6 +4546,7 @@ void ImGui::EndFrame()
     if (g.FrameCountEnded == g.FrameCount)
         return;
     IM_ASSERT(g.WithinFrameScope && "Forgot to call ImGui::NewFrame()?");
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_EndFrame);
 
     ErrorCheckEndFrameSanityChecks();
 
@@ -4204,6 +4592,9 @@ void ImGui::EndFrame()
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because children may not exist yet
+#ifdef IMGUI_DEBUG_PROFILER
+    const ImU64 profiler_start_ticks = ProfilerPhaseBegin(ImGuiProfilerPhase_EndFrameSortWindows);
+#endif
     g.WindowsTempSortBuffer.resize(0);
     g.WindowsTempSortBuffer.reserve(g.Windows.Size);
     for (int i = 0; i != g.Windows.Size; i++)
@@ -4217,6 +4608,9 @@ void ImGui::EndFrame()
     // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
     g.Windows.swap(g.WindowsTempSortBuffer);
+#ifdef IMGUI_DEBUG_PROFILER
+    ProfilerPhaseEnd(ImGuiProfilerPhase_EndFrameSortWindows, profiler_start_ticks);
+#endif
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
@@ -4235,6 +4629,7 @@ void ImGui::Render()
 
     if (g.FrameCountEnded != g.FrameCount)
         EndFrame();
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_Render);
     g.FrameCountRendered = g.FrameCount;
     g.IO.MetricsRenderWindows = 0;
     g.DrawDataBuilder.Clear();
@@ -4244,6 +4639,9 @@ void ImGui::Render()
         AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], &g.BackgroundDrawList);
 
     // Add ImDrawList to render
+#ifdef IMGUI_DEBUG_PROFILER
+    const ImU64 profiler_start_ticks = ProfilerPhaseBegin(ImGuiProfilerPhase_AddRootWindowsToDrawData);
+#endif
     ImGuiWindow* windows_to_render_top_most[2];
     windows_to_render_top_most[0] = (g.NavWindowingTarget && !(g.NavWindowingTarget->Flags & ImGuiWindowFlags_NoBringToFrontOnFocus)) ? g.NavWindowingTarget->RootWindow : NULL;
     windows_to_render_top_most[1] = (g.NavWindowingTarget ? g.NavWindowingListWindow : NULL);
@@ -4257,6 +4655,9 @@ void ImGui::Render()
         if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n])) // NavWindowingTarget is always temporarily displayed as the top-most window
             AddRootWindowToDrawData(windows_to_render_top_most[n]);
     g.DrawDataBuilder.FlattenIntoSingleLayer();
+#ifdef IMGUI_DEBUG_PROFILER
+    ProfilerPhaseEnd(ImGuiProfilerPhase_AddRootWindowsToDrawData, profiler_start_ticks);
+#endif
 
     // Draw software mouse cursor if requested
     if (g.IO.MouseDrawCursor)
@@ -4268,6 +4669,19 @@ void ImGui::Render()
 
     // Setup ImDrawData structure for end-user
     SetupDrawData(&g.DrawDataBuilder.Layers[0], &g.DrawData);
+    if (g.IO.ConfigDrawDataFlatten && g.DrawData.CmdListsCount > 1)
+    {
+        // Output a single draw list. When vertices can't be addressed (16-bit indices without ImGuiBackendFlags_RendererHasVtxOffset) keep the draw lists as is.
+        IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_DrawDataFlatten);
+        if (g.DrawData.MergeCmdLists(&g.DrawDataFlattenedList, (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset) != 0))
+        {
+            g.DrawDataBuilder.Layers[0].resize(1);
+            g.DrawDataBuilder.Layers[0][0] = &g.DrawDataFlattenedList;
+            SetupDrawData(&g.DrawDataBuilder.Layers[0], &g.DrawData);
+        }
+    }
+    UpdateDrawDataListHashes(&g.DrawData);
+    UpdateDrawDataDamageRects(&g.DrawData);
     g.IO.MetricsRenderVertices = g.DrawData.TotalVtxCount;
     g.IO.MetricsRenderIndices = g.DrawData.TotalIdxCount;
 
@@ -5425,12 +5839,70 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
     }
 }
 
+// Idle windows can reuse last frame contents (ImGuiWindowFlags_CacheContents): nothing inside the window may be interacted with or
+// change its look. Includes child windows, as they share our RootWindow, and popups opened from the window.
+bool ImGui::IsWindowContentsIdle(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.HoveredRootWindow == window || (g.HoveredWindowUnderMovingWindow && g.HoveredWindowUnderMovingWindow->RootWindow == window))
+        return false;
+    if ((g.ActiveIdWindow && g.ActiveIdWindow->RootWindow == window) || (g.MovingWindow && g.MovingWindow->RootWindow == window))
+        return false;
+    if ((g.NavWindow && g.NavWindow->RootWindow == window) || g.NavWindowingTarget != NULL || g.NavWindowingTargetAnim != NULL)
+        return false;
+    for (int n = 0; n < g.OpenPopupStack.Size; n++)
+    {
+        const ImGuiPopupData& popup = g.OpenPopupStack[n];
+        if (popup.SourceWindow && popup.SourceWindow->RootWindow == window)
+            return false;
+        if (popup.Window && popup.Window->ParentWindow && popup.Window->ParentWindow->RootWindow == window)
+            return false;
+    }
+    return true;
+}
+
+// Hash the state which affects the output of a window besides its submitted contents. Style changes are not tracked.
+ImGuiID ImGui::CalcWindowContentsHash(ImGuiWindow* window, bool title_bar_is_highlight, const ImU32 resize_grip_col[4], int resize_grip_count)
+{
+    ImGuiContext& g = *GImGui;
+    const ImGuiNextWindowData& next_data = g.NextWindowData;
+    const float values[] =
+    {
+        window->Pos.x, window->Pos.y, window->Size.x, window->Size.y, window->Scroll.x, window->Scroll.y,
+        window->ContentSize.x, window->ContentSize.y, window->ScrollbarSizes.x, window->ScrollbarSizes.y,
+        window->Collapsed ? 1.0f : 0.0f, title_bar_is_highlight ? 1.0f : 0.0f,
+        (next_data.Flags & ImGuiNextWindowDataFlags_HasBgAlpha) ? next_data.BgAlphaVal : -1.0f,
+        g.FontSize, g.Style.Alpha, g.IO.DisplaySize.x, g.IO.DisplaySize.y
+    };
+    const void* pointers[] = { g.Font, g.Font->ContainerAtlas->TexID };
+    ImGuiID hash = ImHashData(values, sizeof(values), (next_data.Flags & ImGuiNextWindowDataFlags_HasContentToken) ? next_data.ContentTokenVal : 0);
+    hash = ImHashData(pointers, sizeof(pointers), hash);
+    hash = ImHashData(resize_grip_col, sizeof(ImU32) * resize_grip_count, hash);
+    return (hash != 0) ? hash : 1; // 0 is reserved for "contents can't be reused"
+}
+
+// Child windows aren't submitted when their parent reuses its contents: keep them active so they are rendered with their own reused draw list.
+void ImGui::KeepAliveChildWindows(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    for (int n = 0; n < window->DC.ChildWindows.Size; n++)
+    {
+        ImGuiWindow* child = window->DC.ChildWindows[n];
+        if (!child->WasActive)
+            continue;
+        child->Active = true;
+        child->LastFrameActive = g.FrameCount;
+        child->LastTimeActive = (float)g.Time;
+        KeepAliveChildWindows(child);
+    }
+}
+
 // Push a new Dear ImGui window to add widgets to.
 // - A default window called "Debug" is automatically stacked at the beginning of every frame so you can use widgets without explicitly calling a Begin/End pair.
 // - Begin/End can be called multiple times during the frame with the same window name to append content.
 // - The window name is used as a unique identifier to preserve window information across frames (and save rudimentary information to the .ini file).
 //   You can use the "##" or "###" markers to use the same label with different id, or same id with different label. See documentation at the top of this file.
-// - Return false when window is collapsed, so you can early out in your code. You always need to call ImGui::End() even if false is returned.
+// - Return false when window is collapsed or reusing last frame contents, so you can early out in your code. You always need to call ImGui::End() even if false is returned.
 // - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
@@ -5439,6 +5911,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
+#ifdef IMGUI_DEBUG_PROFILER
+    const ImU64 profiler_start_ticks = ProfilerPhaseBegin(ImGuiProfilerPhase_Begin);
+#endif
 
     // Find or create
     ImGuiWindow* window = FindWindowByName(name);
@@ -5572,7 +6047,12 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->HasCloseButton = (p_open != NULL);
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
-        window->DrawList->_ResetForNewFrame();
+
+        // Windows which may reuse last frame contents only reset their draw list once we know they can't (see ImGuiWindowFlags_CacheContents below)
+        const bool contents_reuse_allowed = (flags & ImGuiWindowFlags_CacheContents) && !(flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip)) && !window_just_activated_by_user;
+        const bool contents_reuse_candidate = contents_reuse_allowed && window->ContentsHash != 0;
+        if (!contents_reuse_candidate)
+            window->DrawList->_ResetForNewFrame();
 
         // Restore buffer capacity when woken from a compacted state, to avoid
         if (window->MemoryCompacted)
@@ -5851,12 +6331,34 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->Scroll = CalcNextScrollFromScrollTargetAndClamp(window);
         window->ScrollTarget = ImVec2(FLT_MAX, FLT_MAX);
 
+        // CONTENTS CACHE
+
+        // An idle ImGuiWindowFlags_CacheContents window reuses its draw list, layout and child windows from last frame and skips items.
+        // The hash only covers state which isn't submitted as contents: contents changes need to be notified with SetNextWindowContentToken().
+        // Contents are only reused after a full frame submitted while idle, so e.g. hovered colors of last frame don't stick.
+        const ImGuiWindow* window_to_highlight = g.NavWindowingTarget ? g.NavWindowingTarget : g.NavWindow;
+        const bool title_bar_is_highlight = want_focus || (window_to_highlight && window->RootWindowForTitleBarHighlight == window_to_highlight->RootWindowForTitleBarHighlight);
+        ImGuiID contents_hash = 0;
+        if (contents_reuse_allowed && window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0 && IsWindowContentsIdle(window))
+            contents_hash = CalcWindowContentsHash(window, title_bar_is_highlight, resize_grip_col, resize_grip_count);
+        window->ContentsReused = contents_reuse_candidate && contents_hash == window->ContentsHash;
+        window->ContentsHash = contents_hash;
+        if (contents_reuse_candidate && !window->ContentsReused)
+            window->DrawList->_ResetForNewFrame();
+
         // DRAWING
 
         // Setup draw list and outer clipping rectangle
-        IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
-        window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
-        PushClipRect(host_rect.Min, host_rect.Max, false);
+        if (window->ContentsReused)
+        {
+            window->ClipRect = host_rect;
+        }
+        else
+        {
+            IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
+            window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
+            PushClipRect(host_rect.Min, host_rect.Max, false);
+        }
 
         // Draw modal window background (darkens what is behind them, all viewports)
         const bool dim_bg_for_modal = (flags & ImGuiWindowFlags_Modal) && window == GetTopMostPopupModal() && window->HiddenFramesCannotSkipItems <= 0;
@@ -5881,6 +6383,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // We disable this when the parent window has zero vertices, which is a common pattern leading to laying out multiple overlapping child.
         // We also disabled this when we have dimming overlay behind this specific one child.
         // FIXME: More code may rely on explicit sorting of overlapping child window and would need to disable this somehow. Please get in contact if you are affected.
+        if (!window->ContentsReused)
         {
             bool render_decorations_in_parent = false;
             if ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip)
@@ -5890,8 +6393,6 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
                 window->DrawList = parent_window->DrawList;
 
             // Handle title bar, scrollbar, resize grips and resize borders
-            const ImGuiWindow* window_to_highlight = g.NavWindowingTarget ? g.NavWindowingTarget : g.NavWindow;
-            const bool title_bar_is_highlight = want_focus || (window_to_highlight && window->RootWindowForTitleBarHighlight == window_to_highlight->RootWindowForTitleBarHighlight);
             RenderWindowDecorations(window, title_bar_rect, title_bar_is_highlight, resize_grip_count, resize_grip_col, resize_grip_draw_size);
 
             if (render_decorations_in_parent)
@@ -5946,14 +6447,15 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.CursorStartPos = window->Pos + ImVec2(window->DC.Indent.x + window->DC.ColumnsOffset.x, decoration_up_height + window->WindowPadding.y - window->Scroll.y);
         window->DC.CursorPos = window->DC.CursorStartPos;
         window->DC.CursorPosPrevLine = window->DC.CursorPos;
-        window->DC.CursorMaxPos = window->DC.CursorStartPos;
+        if (!window->ContentsReused) // Keep the extents reached by last submission, which the next frame content size is calculated from
+            window->DC.CursorMaxPos = window->DC.CursorStartPos;
         window->DC.CurrLineSize = window->DC.PrevLineSize = ImVec2(0.0f, 0.0f);
         window->DC.CurrLineTextBaseOffset = window->DC.PrevLineTextBaseOffset = 0.0f;
 
         window->DC.NavLayerCurrent = ImGuiNavLayer_Main;
         window->DC.NavLayerCurrentMask = (1 << ImGuiNavLayer_Main);
         window->DC.NavLayerActiveMask = window->DC.NavLayerActiveMaskNext;
-        window->DC.NavLayerActiveMaskNext = 0x00;
+        window->DC.NavLayerActiveMaskNext = window->ContentsReused ? window->DC.NavLayerActiveMask : 0x00;
         window->DC.NavFocusScopeIdCurrent = (flags & ImGuiWindowFlags_ChildWindow) ? parent_window->DC.NavFocusScopeIdCurrent : 0; // -V595
         window->DC.NavHideHighlightOneFrame = false;
         window->DC.NavHasScroll = (window->ScrollMax.y > 0.0f);
@@ -5962,7 +6464,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.MenuColumns.Update(3, style.ItemSpacing.x, window_just_activated_by_user);
         window->DC.TreeDepth = 0;
         window->DC.TreeJumpToParentOnPopMask = 0x00;
-        window->DC.ChildWindows.resize(0);
+        if (window->ContentsReused)
+            KeepAliveChildWindows(window);
+        else
+            window->DC.ChildWindows.resize(0);
         window->DC.StateStorage = &window->StateStorage;
         window->DC.CurrentColumns = NULL;
         window->DC.LayoutType = ImGuiLayoutType_Vertical;
@@ -5992,11 +6497,12 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         }
 
         // Title bar
-        if (!(flags & ImGuiWindowFlags_NoTitleBar))
+        if (!(flags & ImGuiWindowFlags_NoTitleBar) && !window->ContentsReused)
             RenderWindowTitleBarContents(window, title_bar_rect, name, p_open);
 
-        // Clear hit test shape every frame
-        window->HitTestHoleSize.x = window->HitTestHoleSize.y = 0;
+        // Clear hit test shape every frame (unless contents which set it are reused)
+        if (!window->ContentsReused)
+            window->HitTestHoleSize.x = window->HitTestHoleSize.y = 0;
 
         // Pressing CTRL+C while holding on a window copy its content to the clipboard
         // This works but 1. doesn't handle multiple Begin/End pairs, 2. recursing into another Begin/End pair - so we need to work that out and add better logging scope.
@@ -6022,7 +6528,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         SetCurrentWindow(window);
     }
 
-    PushClipRect(window->InnerClipRect.Min, window->InnerClipRect.Max, true);
+    if (window->ContentsReused)
+        window->ClipRect = window->InnerClipRect;
+    else
+        PushClipRect(window->InnerClipRect.Min, window->InnerClipRect.Max, true);
 
     // Clear 'accessed' flag last thing (After PushClipRect which will set the flag. We want the flag to stay false when the default "Debug" window is unused)
     if (first_begin_of_the_frame)
@@ -6056,15 +6565,22 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Update the Hidden flag
         window->Hidden = (window->HiddenFramesCanSkipItems > 0) || (window->HiddenFramesCannotSkipItems > 0);
+        if (window->Hidden)
+            window->ContentsHash = 0;
 
         // Update the SkipItems flag, used to early out of all items functions (no layout required)
-        bool skip_items = false;
+        bool skip_items = window->ContentsReused;
         if (window->Collapsed || !window->Active || window->Hidden)
             if (window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0)
                 skip_items = true;
         window->SkipItems = skip_items;
     }
 
+#ifdef IMGUI_DEBUG_PROFILER
+    window->ProfilerTimeBeginAccum += ProfilerPhaseEnd(ImGuiProfilerPhase_Begin, profiler_start_ticks, window->Name);
+    g.ProfilerWindowStartTicks.push_back(profiler_start_ticks);
+#endif
+
     return !window->SkipItems;
 }
 
@@ -6084,11 +6600,15 @@ void ImGui::End()
     // Error checking: verify that user doesn't directly call End() on a child window.
     if (window->Flags & ImGuiWindowFlags_ChildWindow)
         IM_ASSERT_USER_ERROR(g.WithinEndChild, "Must call EndChild() and not End()!");
+#ifdef IMGUI_DEBUG_PROFILER
+    const ImU64 profiler_start_ticks = ProfilerPhaseBegin(ImGuiProfilerPhase_End);
+#endif
 
     // Close anything that is open
     if (window->DC.CurrentColumns)
         EndColumns();
-    PopClipRect();   // Inner window clip rectangle
+    if (!window->ContentsReused)
+        PopClipRect();   // Inner window clip rectangle
 
     // Stop logging
     if (!(window->Flags & ImGuiWindowFlags_ChildWindow))    // FIXME: add more options for scope of logging
@@ -6100,6 +6620,21 @@ void ImGui::End()
         g.BeginPopupStack.pop_back();
     ErrorCheckBeginEndCompareStacksSize(window, false);
     SetCurrentWindow(g.CurrentWindowStack.empty() ? NULL : g.CurrentWindowStack.back());
+
+#ifdef IMGUI_DEBUG_PROFILER
+    ProfilerPhaseEnd(ImGuiProfilerPhase_End, profiler_start_ticks, window->Name);
+    if (!g.ProfilerWindowStartTicks.empty())
+    {
+        const ImU64 profiler_end_ticks = ProfilerGetTicks();
+        window->ProfilerTimeTotalAccum += ProfilerTicksToSeconds(profiler_end_ticks - g.ProfilerWindowStartTicks.back());
+        if (g.ProfilerTraceActive)
+        {
+            ImGuiProfilerTraceEvent event = { -1, window->Name, g.ProfilerWindowStartTicks.back(), profiler_end_ticks };
+            g.ProfilerTraceEvents.push_back(event);
+        }
+        g.ProfilerWindowStartTicks.pop_back();
+    }
+#endif
 }
 
 void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
@@ -6226,6 +6761,8 @@ void ImGui::SetCurrentFont(ImFont* font)
     ImFontAtlas* atlas = g.Font->ContainerAtlas;
     g.DrawListSharedData.TexUvWhitePixel = atlas->TexUvWhitePixel;
     g.DrawListSharedData.TexUvLines = atlas->TexUvLines;
+    g.DrawListSharedData.TexUvRoundCornersFilled = atlas->TexUvRoundCornersFilled;
+    g.DrawListSharedData.TexUvRoundCornersStroked = atlas->TexUvRoundCornersStroked;
     g.DrawListSharedData.Font = g.Font;
     g.DrawListSharedData.FontSize = g.FontSize;
 }
@@ -6607,6 +7144,13 @@ void ImGui::SetNextWindowBgAlpha(float alpha)
     g.NextWindowData.BgAlphaVal = alpha;
 }
 
+void ImGui::SetNextWindowContentToken(ImGuiID token)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextWindowData.Flags |= ImGuiNextWindowDataFlags_HasContentToken;
+    g.NextWindowData.ContentTokenVal = token;
+}
+
 ImDrawList* ImGui::GetWindowDrawList()
 {
     ImGuiWindow* window = GetCurrentWindow();
@@ -8534,6 +9078,7 @@ static void ImGui::NavUpdate()
 {
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_NavUpdate);
 
     io.WantSetMousePos = false;
     g.NavWrapRequestWindow = NULL;
@@ -9818,6 +10363,7 @@ void ImGui::MarkIniSettingsDirty(ImGuiWindow* window)
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
 
 #if !IMGUI_DEBUG_INI_SETTINGS
     // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
@@ -9886,6 +10432,7 @@ void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
 void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
     IM_ASSERT(g.Initialized);
     //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
     //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
@@ -9959,6 +10506,7 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
     g.SettingsDirtyTimer = 0.0f;
     if (!ini_filename)
         return;
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_SaveIniSettings);
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
@@ -9973,6 +10521,8 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_SaveIniSettings);
     g.SettingsDirtyTimer = 0.0f;
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
@@ -10238,6 +10788,579 @@ static void ImeSetInputScreenPosFn_DefaultImpl(int, int) {}
 
 #endif
 
+//-----------------------------------------------------------------------------
+// [SECTION] INPUT RECORDING
+//-----------------------------------------------------------------------------
+// - ImGuiInputRecorder
+// - ImGuiInputReplay
+// - DebugHashDrawData()
+//-----------------------------------------------------------------------------
+
+static const char   IMGUI_INPUT_RECORD_MAGIC[4] = { 'I', 'm', 'I', 'R' };
+static const ImU32  IMGUI_INPUT_RECORD_VERSION = 1;
+
+// Fields stored in a frame, in this order, when they changed since the previous frame
+enum ImGuiInputRecordField_
+{
+    ImGuiInputRecordField_DeltaTime     = 1 << 0,   // float
+    ImGuiInputRecordField_DisplaySize   = 1 << 1,   // float x2
+    ImGuiInputRecordField_MousePos      = 1 << 2,   // float x2
+    ImGuiInputRecordField_MouseDown     = 1 << 3,   // ImU8 mask of buttons
+    ImGuiInputRecordField_MouseWheel    = 1 << 4,   // float x2 (vertical, horizontal)
+    ImGuiInputRecordField_KeyMods       = 1 << 5,   // ImU8 mask of Ctrl, Shift, Alt, Super
+    ImGuiInputRecordField_KeysDown      = 1 << 6,   // ImU16 count, ImU16 index of each key which changed state
+    ImGuiInputRecordField_NavInputs     = 1 << 7,   // ImU8 count, ImU8 index + float value of each nav input which changed
+    ImGuiInputRecordField_Chars         = 1 << 8    // ImU16 count, ImU32 each character of io.InputQueueCharacters[]
+};
+
+static void InputRecordWrite(ImVector<unsigned char>& data, const void* src, int size)
+{
+    data.resize(data.Size + size);
+    memcpy(data.Data + data.Size - size, src, (size_t)size);
+}
+
+static bool InputRecordRead(const ImVector<unsigned char>& data, int* offset, void* dst, int size)
+{
+    if (*offset + size > data.Size)
+        return false;
+    memcpy(dst, data.Data + *offset, (size_t)size);
+    *offset += size;
+    return true;
+}
+
+static ImU8 InputRecordMouseDownMask(const bool* mouse_down)
+{
+    ImU8 mask = 0;
+    for (int n = 0; n < 5; n++)
+        if (mouse_down[n])
+            mask |= (ImU8)(1 << n);
+    return mask;
+}
+
+void ImGuiInputRecorder::RecordFrame(const ImGuiIO& io)
+{
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(io.MouseDown) == IM_ARRAYSIZE(State.MouseDown));
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(io.KeysDown) == IM_ARRAYSIZE(State.KeysDown));
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(io.NavInputs) == IM_ARRAYSIZE(State.NavInputs));
+    if (Data.empty())
+    {
+        InputRecordWrite(Data, IMGUI_INPUT_RECORD_MAGIC, 4);
+        InputRecordWrite(Data, &IMGUI_INPUT_RECORD_VERSION, 4);
+    }
+
+    // Reserve space for the field mask, written last
+    const int fields_offset = Data.Size;
+    ImU16 fields = 0;
+    Data.resize(Data.Size + 2);
+
+    if (io.DeltaTime != State.DeltaTime)
+    {
+        fields |= ImGuiInputRecordField_DeltaTime;
+        State.DeltaTime = io.DeltaTime;
+        InputRecordWrite(Data, &State.DeltaTime, 4);
+    }
+    if (io.DisplaySize.x != State.DisplaySize.x || io.DisplaySize.y != State.DisplaySize.y)
+    {
+        fields |= ImGuiInputRecordField_DisplaySize;
+        State.DisplaySize = io.DisplaySize;
+        InputRecordWrite(Data, &State.DisplaySize.x, 4);
+        InputRecordWrite(Data, &State.DisplaySize.y, 4);
+    }
+    if (io.MousePos.x != State.MousePos.x || io.MousePos.y != State.MousePos.y)
+    {
+        fields |= ImGuiInputRecordField_MousePos;
+        State.MousePos = io.MousePos;
+        InputRecordWrite(Data, &State.MousePos.x, 4);
+        InputRecordWrite(Data, &State.MousePos.y, 4);
+    }
+    const ImU8 mouse_down_mask = InputRecordMouseDownMask(io.MouseDown);
+    if (mouse_down_mask != InputRecordMouseDownMask(State.MouseDown))
+    {
+        fields |= ImGuiInputRecordField_MouseDown;
+        memcpy(State.MouseDown, io.MouseDown, sizeof(State.MouseDown));
+        InputRecordWrite(Data, &mouse_down_mask, 1);
+    }
+    if (io.MouseWheel != State.MouseWheel || io.MouseWheelH != State.MouseWheelH)
+    {
+        fields |= ImGuiInputRecordField_MouseWheel;
+        State.MouseWheel = io.MouseWheel;
+        State.MouseWheelH = io.MouseWheelH;
+        InputRecordWrite(Data, &State.MouseWheel, 4);
+        InputRecordWrite(Data, &State.MouseWheelH, 4);
+    }
+    if (io.KeyCtrl != State.KeyCtrl || io.KeyShift != State.KeyShift || io.KeyAlt != State.KeyAlt || io.KeySuper != State.KeySuper)
+    {
+        fields |= ImGuiInputRecordField_KeyMods;
+        State.KeyCtrl = io.KeyCtrl;
+        State.KeyShift = io.KeyShift;
+        State.KeyAlt = io.KeyAlt;
+        State.KeySuper = io.KeySuper;
+        const ImU8 key_mods_mask = (ImU8)((io.KeyCtrl ? 1 : 0) | (io.KeyShift ? 2 : 0) | (io.KeyAlt ? 4 : 0) | (io.KeySuper ? 8 : 0));
+        InputRecordWrite(Data, &key_mods_mask, 1);
+    }
+    ImU16 keys_changed_count = 0;
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown); n++)
+        if (io.KeysDown[n] != State.KeysDown[n])
+            keys_changed_count++;
+    if (keys_changed_count > 0)
+    {
+        fields |= ImGuiInputRecordField_KeysDown;
+        InputRecordWrite(Data, &keys_changed_count, 2);
+        for (ImU16 n = 0; n < IM_ARRAYSIZE(io.KeysDown); n++)
+            if (io.KeysDown[n] != State.KeysDown[n])
+            {
+                State.KeysDown[n] = io.KeysDown[n];
+                InputRecordWrite(Data, &n, 2);
+            }
+    }
+    ImU8 nav_inputs_changed_count = 0;
+    for (int n = 0; n < IM_ARRAYSIZE(io.NavInputs); n++)
+        if (io.NavInputs[n] != State.NavInputs[n])
+            nav_inputs_changed_count++;
+    if (nav_inputs_changed_count > 0)
+    {
+        fields |= ImGuiInputRecordField_NavInputs;
+        InputRecordWrite(Data, &nav_inputs_changed_count, 1);
+        for (ImU8 n = 0; n < IM_ARRAYSIZE(io.NavInputs); n++)
+            if (io.NavInputs[n] != State.NavInputs[n])
+            {
+                State.NavInputs[n] = io.NavInputs[n];
+                InputRecordWrite(Data, &n, 1);
+                InputRecordWrite(Data, &State.NavInputs[n], 4);
+            }
+    }
+    if (io.InputQueueCharacters.Size > 0)
+    {
+        fields |= ImGuiInputRecordField_Chars;
+        const ImU16 chars_count = (ImU16)ImMin(io.InputQueueCharacters.Size, 0xFFFF);
+        InputRecordWrite(Data, &chars_count, 2);
+        for (int n = 0; n < chars_count; n++)
+        {
+            const ImU32 c = (ImU32)io.InputQueueCharacters[n];
+            InputRecordWrite(Data, &c, 4);
+        }
+    }
+
+    memcpy(Data.Data + fields_offset, &fields, 2);
+    FramesCount++;
+}
+
+bool ImGuiInputRecorder::SaveToFile(const char* filename) const
+{
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ret;
+    if (Data.empty())
+        ret = ImFileWrite(IMGUI_INPUT_RECORD_MAGIC, 4, 1, f) == 1 && ImFileWrite(&IMGUI_INPUT_RECORD_VERSION, 4, 1, f) == 1;
+    else
+        ret = ImFileWrite(Data.Data, 1, (ImU64)Data.Size, f) == (ImU64)Data.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+// Read one frame into 'state', and apply it to 'io' if not NULL. Return false if the data is truncated or invalid.
+static bool InputRecordReadFrame(const ImVector<unsigned char>& data, int* offset, ImGuiInputRecordState* state, ImGuiIO* io)
+{
+    ImU16 fields = 0;
+    if (!InputRecordRead(data, offset, &fields, 2))
+        return false;
+    if (fields & ImGuiInputRecordField_DeltaTime)
+        if (!InputRecordRead(data, offset, &state->DeltaTime, 4))
+            return false;
+    if (fields & ImGuiInputRecordField_DisplaySize)
+        if (!InputRecordRead(data, offset, &state->DisplaySize.x, 4) || !InputRecordRead(data, offset, &state->DisplaySize.y, 4))
+            return false;
+    if (fields & ImGuiInputRecordField_MousePos)
+        if (!InputRecordRead(data, offset, &state->MousePos.x, 4) || !InputRecordRead(data, offset, &state->MousePos.y, 4))
+            return false;
+    if (fields & ImGuiInputRecordField_MouseDown)
+    {
+        ImU8 mask = 0;
+        if (!InputRecordRead(data, offset, &mask, 1))
+            return false;
+        for (int n = 0; n < IM_ARRAYSIZE(state->MouseDown); n++)
+            state->MouseDown[n] = (mask & (1 << n)) != 0;
+    }
+    if (fields & ImGuiInputRecordField_MouseWheel)
+        if (!InputRecordRead(data, offset, &state->MouseWheel, 4) || !InputRecordRead(data, offset, &state->MouseWheelH, 4))
+            return false;
+    if (fields & ImGuiInputRecordField_KeyMods)
+    {
+        ImU8 mask = 0;
+        if (!InputRecordRead(data, offset, &mask, 1))
+            return false;
+        state->KeyCtrl = (mask & 1) != 0;
+        state->KeyShift = (mask & 2) != 0;
+        state->KeyAlt = (mask & 4) != 0;
+        state->KeySuper = (mask & 8) != 0;
+    }
+    if (fields & ImGuiInputRecordField_KeysDown)
+    {
+        ImU16 count = 0;
+        if (!InputRecordRead(data, offset, &count, 2))
+            return false;
+        for (int n = 0; n < count; n++)
+        {
+            ImU16 key = 0;
+            if (!InputRecordRead(data, offset, &key, 2) || key >= IM_ARRAYSIZE(state->KeysDown))
+                return false;
+            state->KeysDown[key] = !state->KeysDown[key];
+        }
+    }
+    if (fields & ImGuiInputRecordField_NavInputs)
+    {
+        ImU8 count = 0;
+        if (!InputRecordRead(data, offset, &count, 1))
+            return false;
+        for (int n = 0; n < count; n++)
+        {
+            ImU8 nav_input = 0;
+            if (!InputRecordRead(data, offset, &nav_input, 1) || nav_input >= IM_ARRAYSIZE(state->NavInputs))
+                return false;
+            if (!InputRecordRead(data, offset, &state->NavInputs[nav_input], 4))
+                return false;
+        }
+    }
+    if (io)
+    {
+        io->DeltaTime = state->DeltaTime;
+        io->DisplaySize = state->DisplaySize;
+        io->MousePos = state->MousePos;
+        memcpy(io->MouseDown, state->MouseDown, sizeof(io->MouseDown));
+        io->MouseWheel = state->MouseWheel;
+        io->MouseWheelH = state->MouseWheelH;
+        io->KeyCtrl = state->KeyCtrl;
+        io->KeyShift = state->KeyShift;
+        io->KeyAlt = state->KeyAlt;
+        io->KeySuper = state->KeySuper;
+        memcpy(io->KeysDown, state->KeysDown, sizeof(io->KeysDown));
+        memcpy(io->NavInputs, state->NavInputs, sizeof(io->NavInputs));
+    }
+    if (fields & ImGuiInputRecordField_Chars)
+    {
+        ImU16 count = 0;
+        if (!InputRecordRead(data, offset, &count, 2))
+            return false;
+        for (int n = 0; n < count; n++)
+        {
+            ImU32 c = 0;
+            if (!InputRecordRead(data, offset, &c, 4))
+                return false;
+            if (io)
+                io->InputQueueCharacters.push_back((ImWchar)c);
+        }
+    }
+    return true;
+}
+
+bool ImGuiInputReplay::LoadFromMemory(const void* data, size_t data_size)
+{
+    Clear();
+    Data.resize((int)data_size);
+    memcpy(Data.Data, data, data_size);
+
+    // Validate the whole recording and count frames, so ApplyNextFrame() doesn't have to deal with errors
+    char magic[4];
+    ImU32 version = 0;
+    int offset = 0;
+    if (!InputRecordRead(Data, &offset, magic, 4) || memcmp(magic, IMGUI_INPUT_RECORD_MAGIC, 4) != 0 || !InputRecordRead(Data, &offset, &version, 4) || version != IMGUI_INPUT_RECORD_VERSION)
+    {
+        Clear();
+        return false;
+    }
+    ReadOffset = offset;
+    ImGuiInputRecordState state;
+    while (offset < Data.Size)
+    {
+        if (!InputRecordReadFrame(Data, &offset, &state, NULL))
+        {
+            Clear();
+            return false;
+        }
+        FramesCount++;
+    }
+    return true;
+}
+
+bool ImGuiInputReplay::LoadFromFile(const char* filename)
+{
+    size_t file_data_size = 0;
+    void* file_data = ImFileLoadToMemory(filename, "rb", &file_data_size);
+    if (!file_data)
+        return false;
+    bool ret = LoadFromMemory(file_data, file_data_size);
+    IM_FREE(file_data);
+    return ret;
+}
+
+bool ImGuiInputReplay::ApplyNextFrame(ImGuiIO* io)
+{
+    if (FrameIdx >= FramesCount)
+        return false;
+    bool ret = InputRecordReadFrame(Data, &ReadOffset, &State, io);
+    IM_ASSERT(ret); // Validated by LoadFromMemory()
+    FrameIdx++;
+    return ret;
+}
+
+// Hash vertices, indices and draw commands (excluding user callbacks) of all draw lists.
+// Note that vertex positions are floating-point results, so the hash may differ across compilers or CPU architectures.
+ImU32 ImGui::DebugHashDrawData(const ImDrawData* draw_data)
+{
+    ImU32 hash = 0;
+    if (draw_data == NULL || !draw_data->Valid)
+        return hash;
+    hash = ImHashData(&draw_data->DisplayPos, sizeof(draw_data->DisplayPos), hash);
+    hash = ImHashData(&draw_data->DisplaySize, sizeof(draw_data->DisplaySize), hash);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+        hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd* cmd = &draw_list->CmdBuffer[cmd_n];
+            hash = ImHashData(&cmd->ClipRect, sizeof(cmd->ClipRect), hash);
+            hash = ImHashData(&cmd->TextureId, sizeof(cmd->TextureId), hash);
+            hash = ImHashData(&cmd->VtxOffset, sizeof(cmd->VtxOffset), hash);
+            hash = ImHashData(&cmd->IdxOffset, sizeof(cmd->IdxOffset), hash);
+            hash = ImHashData(&cmd->ElemCount, sizeof(cmd->ElemCount), hash);
+        }
+    }
+    return hash;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - GetProfilerPhaseTime()
+// - ProfilerGetTicks() [Internal]
+// - ProfilerTicksToSeconds() [Internal]
+// - ProfilerPhaseBegin(), ProfilerPhaseEnd() [Internal]
+// - ProfilerGetFrame() [Internal]
+// - ProfilerGetPhaseName() [Internal]
+// - ProfilerNewFrame() [Internal]
+// - ProfilerTraceStart(), ProfilerTraceStop() [Internal]
+// - ProfilerTraceExport(), ProfilerTraceSaveToFile() [Internal]
+//-----------------------------------------------------------------------------
+
+float ImGui::GetProfilerPhaseTime(ImGuiProfilerPhase phase, int frames_ago)
+{
+    IM_ASSERT(phase >= 0 && phase < ImGuiProfilerPhase_COUNT);
+#ifdef IMGUI_DEBUG_PROFILER
+    ImGuiProfilerFrame* frame = ProfilerGetFrame(frames_ago);
+    return frame ? frame->PhaseTime[phase] * 1000.0f : 0.0f;
+#else
+    IM_UNUSED(frames_ago);
+    return 0.0f;
+#endif
+}
+
+#ifdef IMGUI_DEBUG_PROFILER
+
+ImU64 ImGui::ProfilerGetTicks()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (ImU64)counter.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#else
+    return (ImU64)clock();
+#endif
+}
+
+static double ProfilerGetTicksPerSecond()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    static ImU64 ticks_per_second = 0;
+    if (ticks_per_second == 0)
+    {
+        LARGE_INTEGER frequency;
+        ::QueryPerformanceFrequency(&frequency);
+        ticks_per_second = (ImU64)frequency.QuadPart;
+    }
+    return (double)ticks_per_second;
+#elif defined(CLOCK_MONOTONIC)
+    return 1000000000.0;
+#else
+    return (double)CLOCKS_PER_SEC;
+#endif
+}
+
+float ImGui::ProfilerTicksToSeconds(ImU64 ticks)
+{
+    return (float)((double)ticks / ProfilerGetTicksPerSecond());
+}
+
+// Only the outer-most scope of a given phase is recorded, so recursive or nested calls are not counted twice.
+// Font atlases may be built without a current context, in which case nothing is recorded.
+ImU64 ImGui::ProfilerPhaseBegin(ImGuiProfilerPhase phase)
+{
+    if (ImGuiContext* ctx = GImGui)
+        ctx->ProfilerPhaseDepth[phase]++;
+    return ProfilerGetTicks();
+}
+
+float ImGui::ProfilerPhaseEnd(ImGuiProfilerPhase phase, ImU64 start_ticks, const char* window_name)
+{
+    const ImU64 end_ticks = ProfilerGetTicks();
+    const float elapsed = ProfilerTicksToSeconds(end_ticks - start_ticks);
+    if (GImGui == NULL)
+        return elapsed;
+    ImGuiContext& g = *GImGui;
+    if (--g.ProfilerPhaseDepth[phase] > 0)
+        return elapsed;
+    g.ProfilerPhaseTotalTime[phase] += elapsed;
+    g.ProfilerPhaseTotalCount[phase]++;
+    if (g.ProfilerTraceActive)
+    {
+        ImGuiProfilerTraceEvent event = { phase, window_name, start_ticks, end_ticks };
+        g.ProfilerTraceEvents.push_back(event);
+    }
+
+    // Timings may be submitted before the first NewFrame() (e.g. End() in error recovery), ignore them.
+    ImGuiProfilerFrame* frame = &g.ProfilerFrames[g.ProfilerFrameIdx];
+    if (frame->FrameCount == 0 || start_ticks < frame->StartTicks)
+        return elapsed;
+    if (frame->PhaseStart[phase] < 0.0f)
+        frame->PhaseStart[phase] = ProfilerTicksToSeconds(start_ticks - frame->StartTicks);
+    frame->PhaseTime[phase] += elapsed;
+
+    // The whole frame extends to the end of the last recorded phase
+    frame->PhaseStart[ImGuiProfilerPhase_Frame] = 0.0f;
+    frame->PhaseTime[ImGuiProfilerPhase_Frame] = ProfilerTicksToSeconds(end_ticks - frame->StartTicks);
+    return elapsed;
+}
+
+// frames_ago == 0 is the current frame (or the last rendered frame if called between Render() and NewFrame())
+ImGuiProfilerFrame* ImGui::ProfilerGetFrame(int frames_ago)
+{
+    ImGuiContext& g = *GImGui;
+    if (frames_ago < 0 || frames_ago >= IMGUI_PROFILER_HISTORY_SIZE)
+        return NULL;
+    ImGuiProfilerFrame* frame = &g.ProfilerFrames[(g.ProfilerFrameIdx - frames_ago + IMGUI_PROFILER_HISTORY_SIZE) % IMGUI_PROFILER_HISTORY_SIZE];
+    return (frame->FrameCount != 0) ? frame : NULL;
+}
+
+const char* ImGui::ProfilerGetPhaseName(ImGuiProfilerPhase phase)
+{
+    const char* names[] = { "Frame", "NewFrame", "NavUpdate", "UpdateHoveredWindow", "SaveIniSettings", "Begin", "End", "EndFrame", "EndFrameSortWindows", "Render", "AddRootWindowsToDrawData", "DrawDataFlatten", "DrawDataDamage", "DrawDataListHashes", "FontAtlasBuild", "FontAtlasGlyphLookup", "FontAtlasPackRects", "FontAtlasRasterize", "FontAtlasFinish" };
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(names) == ImGuiProfilerPhase_COUNT);
+    IM_ASSERT(phase >= 0 && phase < ImGuiProfilerPhase_COUNT);
+    return names[phase];
+}
+
+// Commit timings of the previous frame to the history and start recording a new frame.
+static void ImGui::ProfilerNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    g.ProfilerFrameIdx = (g.ProfilerFrameIdx + 1) % IMGUI_PROFILER_HISTORY_SIZE;
+    g.ProfilerFrames[g.ProfilerFrameIdx].Clear(g.FrameCount + 1, ProfilerGetTicks());
+    g.ProfilerWindowStartTicks.resize(0);
+    for (int i = 0; i != g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        window->ProfilerTimeBegin = window->ProfilerTimeBeginAccum;
+        window->ProfilerTimeTotal = window->ProfilerTimeTotalAccum;
+        window->ProfilerTimeBeginAccum = window->ProfilerTimeTotalAccum = 0.0f;
+    }
+}
+
+ImGuiProfilerScope::ImGuiProfilerScope(ImGuiProfilerPhase phase)
+{
+    Phase = phase;
+    StartTicks = ImGui::ProfilerPhaseBegin(phase);
+}
+
+ImGuiProfilerScope::~ImGuiProfilerScope()
+{
+    ImGui::ProfilerPhaseEnd(Phase, StartTicks);
+}
+
+void ImGuiProfilerScope::NextPhase(ImGuiProfilerPhase phase)
+{
+    ImGui::ProfilerPhaseEnd(Phase, StartTicks);
+    Phase = phase;
+    StartTicks = ImGui::ProfilerPhaseBegin(phase);
+}
+
+// While a trace capture is active, every outer-most phase and every window Begin()..End() span is kept in memory.
+// Window names are referenced, not copied: export before destroying the context.
+void ImGui::ProfilerTraceStart()
+{
+    ImGuiContext& g = *GImGui;
+    g.ProfilerTraceEvents.clear();
+    g.ProfilerTraceActive = true;
+}
+
+void ImGui::ProfilerTraceStop()
+{
+    ImGuiContext& g = *GImGui;
+    g.ProfilerTraceActive = false;
+}
+
+static void ProfilerTraceAppendString(ImGuiTextBuffer* buf, const char* str)
+{
+    buf->append("\"");
+    for (const char* p = str; *p; p++)
+    {
+        const unsigned char c = (unsigned char)*p;
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else if (c < 0x20)
+            buf->appendf("\\u%04x", c);
+        else
+            buf->append(p, p + 1);
+    }
+    buf->append("\"");
+}
+
+// Output complete events ("ph":"X") with timestamps in microseconds from ProfilerGetTicks(), which uses the same
+// clock as most native tracers (QueryPerformanceCounter() on Windows, CLOCK_MONOTONIC elsewhere), so events
+// can be merged with the application's own events and appear on the same timeline.
+void ImGui::ProfilerTraceExport(ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *GImGui;
+    const double ticks_to_us = 1000000.0 / ProfilerGetTicksPerSecond();
+    buf->append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Dear ImGui\"}}");
+    for (int n = 0; n < g.ProfilerTraceEvents.Size; n++)
+    {
+        const ImGuiProfilerTraceEvent& event = g.ProfilerTraceEvents[n];
+        const bool is_window_span = (event.Phase < 0);
+        buf->append(",\n{\"name\":");
+        ProfilerTraceAppendString(buf, is_window_span ? event.WindowName : ProfilerGetPhaseName(event.Phase));
+        buf->appendf(",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f", is_window_span ? "window" : "imgui", (double)event.StartTicks * ticks_to_us, (double)(event.EndTicks - event.StartTicks) * ticks_to_us);
+        if (!is_window_span && event.WindowName)
+        {
+            buf->append(",\"args\":{\"window\":");
+            ProfilerTraceAppendString(buf, event.WindowName);
+            buf->append("}");
+        }
+        buf->append("}");
+    }
+}
+
+bool ImGui::ProfilerTraceSaveToFile(const char* filename)
+{
+    ImGuiTextBuffer buf;
+    buf.append("{\"traceEvents\":[\n");
+    ProfilerTraceExport(&buf);
+    buf.append("\n],\"displayTimeUnit\":\"ms\"}\n");
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ret = ImFileWrite(buf.c_str(), 1, (ImU64)buf.size(), f) == (ImU64)buf.size();
+    ImFileClose(f);
+    return ret;
+}
+
+#endif // #ifdef IMGUI_DEBUG_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUG WINDOW
 //-----------------------------------------------------------------------------
@@ -10279,6 +11402,9 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     static int  show_tables_rect_type = TRT_WorkRect;
     static bool show_drawcmd_mesh = true;
     static bool show_drawcmd_aabb = true;
+#ifdef IMGUI_DEBUG_PROFILER
+    static int  show_profiler_frames_ago = 1;
+#endif
 
     // Basic info
     ImGuiContext& g = *GImGui;
@@ -10297,6 +11423,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     // - NodeWindows()
     // - NodeTabBar()
     // - NodeStorage()
+    // - NodeProfilerPhase()
     struct Funcs
     {
         static ImRect GetWindowRect(ImGuiWindow* window, int rect_type)
@@ -10363,6 +11490,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
             if (window && !window->WasActive)
                 ImGui::TextDisabled("Warning: owning Window is inactive. This DrawList is not being rendered!");
+            if (draw_list->ContentHash != 0)
+                ImGui::BulletText("ContentHash: 0x%08X%s", draw_list->ContentHash, draw_list->ContentChanged ? " (changed)" : "");
 
             unsigned int elem_offset = 0;
             for (const ImDrawCmd* pcmd = draw_list->CmdBuffer.begin(); pcmd < draw_list->CmdBuffer.end(); elem_offset += pcmd->ElemCount, pcmd++)
@@ -10413,9 +11542,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                         for (int n = 0; n < 3; n++, idx_i++)
                         {
                             ImDrawVert& v = draw_list->VtxBuffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                            const ImVec2 uv = v.uv;
                             triangle[n] = v.pos;
                             buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                                (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                                (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                         }
 
                         ImGui::Selectable(buf, false);
@@ -10477,6 +11607,9 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
             if (window->MemoryCompacted)
                 ImGui::TextDisabled("Note: some memory buffers have been compacted/freed.");
+#ifdef IMGUI_DEBUG_PROFILER
+            ImGui::BulletText("Profiler: Begin() %.3f ms, Begin()..End() %.3f ms (previous frame)", window->ProfilerTimeBegin * 1000.0f, window->ProfilerTimeTotal * 1000.0f);
+#endif
 
             ImGuiWindowFlags flags = window->Flags;
             NodeDrawList(window, window->DrawList, "DrawList");
@@ -10488,6 +11621,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             ImGui::BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
             ImGui::BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
             ImGui::BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+            if (flags & ImGuiWindowFlags_CacheContents)
+                ImGui::BulletText("ContentsReused: %d, ContentsHash: 0x%08X", window->ContentsReused, window->ContentsHash);
             ImGui::BulletText("NavLastIds: 0x%08X,0x%08X, NavLayerActiveMask: %X", window->NavLastIds[0], window->NavLastIds[1], window->DC.NavLayerActiveMask);
             ImGui::BulletText("NavLastChildNavWindow: %s", window->NavLastChildNavWindow ? window->NavLastChildNavWindow->Name : "NULL");
             if (!window->NavRectRel[0].IsInverted())
@@ -10551,6 +11686,46 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             }
             ImGui::TreePop();
         }
+
+#ifdef IMGUI_DEBUG_PROFILER
+        // Display one row of the timeline: phase name, duration and a bar positioned relative to the whole frame.
+        static void NodeProfilerPhase(const ImGuiProfilerFrame* frame, ImGuiProfilerPhase phase, const char* label, float label_width, bool is_aggregate)
+        {
+            const float frame_time = frame->PhaseTime[ImGuiProfilerPhase_Frame];
+            const float phase_start = frame->PhaseStart[phase];
+            const float phase_time = frame->PhaseTime[phase];
+            ImGui::Text("%s", label);
+            ImGui::SameLine(label_width);
+            ImGui::Text("%7.3f ms", phase_time * 1000.0f);
+            ImGui::SameLine();
+            ImGui::Dummy(ImVec2(ImMax(ImGui::GetContentRegionAvail().x, 1.0f), ImGui::GetTextLineHeight()));
+            ImRect bb(ImGui::GetItemRectMin(), ImGui::GetItemRectMax());
+            ImDrawList* draw_list = ImGui::GetWindowDrawList();
+            draw_list->AddRectFilled(bb.Min, bb.Max, ImGui::GetColorU32(ImGuiCol_FrameBg));
+            if (phase_start < 0.0f || frame_time <= 0.0f)
+                return;
+            float x0 = ImLerp(bb.Min.x, bb.Max.x, ImSaturate(phase_start / frame_time));
+            float x1 = ImLerp(bb.Min.x, bb.Max.x, ImSaturate((phase_start + phase_time) / frame_time));
+            draw_list->AddRectFilled(ImVec2(x0, bb.Min.y), ImVec2(ImMax(x1, x0 + 1.0f), bb.Max.y), ImGui::GetColorU32(is_aggregate ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram));
+            if (ImGui::IsItemHovered())
+                ImGui::SetTooltip("%s\nStart: +%.3f ms\nDuration: %.3f ms (%.1f%% of frame)%s", label, phase_start * 1000.0f, phase_time * 1000.0f, 100.0f * phase_time / frame_time,
+                    is_aggregate ? "\n(Total of all calls, bar is positioned at the first call)" : "");
+        }
+
+        static float ProfilerPhaseGetter(void* data, int idx)
+        {
+            // idx 0 is the oldest frame, the current (incomplete) frame is excluded
+            ImGuiProfilerFrame* frame = ImGui::ProfilerGetFrame(IMGUI_PROFILER_HISTORY_SIZE - 1 - idx);
+            return frame ? frame->PhaseTime[(int)(intptr_t)data] * 1000.0f : 0.0f;
+        }
+
+        static int IMGUI_CDECL ProfilerWindowCompareByTotalTime(const void* lhs, const void* rhs)
+        {
+            const float lhs_time = (*(const ImGuiWindow* const *)lhs)->ProfilerTimeTotal;
+            const float rhs_time = (*(const ImGuiWindow* const *)rhs)->ProfilerTimeTotal;
+            return (lhs_time < rhs_time) ? +1 : (lhs_time > rhs_time) ? -1 : 0;
+        }
+#endif
     };
 
     // Tools
@@ -10683,6 +11858,126 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGui::TreePop();
     }
 
+    // Profiler
+    if (ImGui::TreeNode("Profiler"))
+    {
+#ifdef IMGUI_DEBUG_PROFILER
+        const char* phase_names[] = { "Frame", "  NewFrame", "    NavUpdate", "    UpdateHoveredWindow", "    SaveIniSettings", "  Begin", "  End", "  EndFrame", "    SortWindows", "  Render", "    AddRootWindowsToDrawData", "    DrawDataFlatten", "    DrawDataDamage", "    DrawDataListHashes", "FontAtlasBuild", "  GlyphLookup", "  PackRects", "  Rasterize", "  Finish" };
+        IM_ASSERT(IM_ARRAYSIZE(phase_names) == ImGuiProfilerPhase_COUNT);
+        const float label_width = ImGui::CalcTextSize(phase_names[ImGuiProfilerPhase_AddRootWindowsToDrawData]).x + ImGui::GetStyle().ItemSpacing.x * 2.0f;
+
+        // Timeline of a single frame. The current frame is still being recorded so we default to the previous one.
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 12);
+        ImGui::SliderInt("Frames ago", &show_profiler_frames_ago, 1, IMGUI_PROFILER_HISTORY_SIZE - 1);
+        if (const ImGuiProfilerFrame* frame = ProfilerGetFrame(show_profiler_frames_ago))
+        {
+            ImGui::Text("Frame %d: %.3f ms", frame->FrameCount, frame->PhaseTime[ImGuiProfilerPhase_Frame] * 1000.0f);
+            for (int phase = 0; phase < ImGuiProfilerPhase_COUNT; phase++)
+                Funcs::NodeProfilerPhase(frame, phase, phase_names[phase], label_width, phase == ImGuiProfilerPhase_Begin || phase == ImGuiProfilerPhase_End);
+        }
+        else
+        {
+            ImGui::TextDisabled("No data recorded for this frame.");
+        }
+
+        // History graph of each phase
+        if (ImGui::TreeNode("History"))
+        {
+            for (int phase = 0; phase < ImGuiProfilerPhase_COUNT; phase++)
+            {
+                float time_avg = 0.0f, time_max = 0.0f;
+                int frames_count = 0;
+                for (int frames_ago = 1; frames_ago < IMGUI_PROFILER_HISTORY_SIZE; frames_ago++)
+                    if (const ImGuiProfilerFrame* frame = ProfilerGetFrame(frames_ago))
+                    {
+                        time_avg += frame->PhaseTime[phase];
+                        time_max = ImMax(time_max, frame->PhaseTime[phase]);
+                        frames_count++;
+                    }
+                time_avg = (frames_count > 0) ? time_avg / frames_count : 0.0f;
+                char overlay[64];
+                ImFormatString(overlay, IM_ARRAYSIZE(overlay), "avg %.3f ms, max %.3f ms", time_avg * 1000.0f, time_max * 1000.0f);
+                ImGui::PlotLines(phase_names[phase], Funcs::ProfilerPhaseGetter, (void*)(intptr_t)phase, IMGUI_PROFILER_HISTORY_SIZE - 1, 0, overlay, 0.0f, FLT_MAX, ImVec2(0.0f, ImGui::GetFontSize() * 3.0f));
+            }
+            ImGui::TreePop();
+        }
+
+        // Totals since context creation, which also include phases running outside of frames (e.g. font atlas builds)
+        if (ImGui::TreeNode("Totals"))
+        {
+            for (int phase = ImGuiProfilerPhase_Frame + 1; phase < ImGuiProfilerPhase_COUNT; phase++)
+            {
+                const int count = g.ProfilerPhaseTotalCount[phase];
+                ImGui::Text("%s", phase_names[phase]);
+                ImGui::SameLine(label_width);
+                ImGui::Text("%10.3f ms, %6d calls, %.3f ms avg", g.ProfilerPhaseTotalTime[phase] * 1000.0, count, (count > 0) ? g.ProfilerPhaseTotalTime[phase] * 1000.0 / count : 0.0);
+            }
+            ImGui::TreePop();
+        }
+
+        // Trace capture, to inspect individual calls in chrome://tracing or Perfetto
+        if (ImGui::Button(g.ProfilerTraceActive ? "Stop trace" : "Start trace"))
+        {
+            if (g.ProfilerTraceActive)
+                ProfilerTraceStop();
+            else
+                ProfilerTraceStart();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Save 'imgui_trace.json'"))
+            ProfilerTraceSaveToFile("imgui_trace.json");
+        ImGui::SameLine();
+        ImGui::Text("%d events", g.ProfilerTraceEvents.Size);
+
+        // Windows sorted by time spent between Begin() and End()
+        if (ImGui::TreeNode("Windows", "Windows (by Begin()..End() time)"))
+        {
+            ImVector<ImGuiWindow*> windows;
+            for (int n = 0; n < g.Windows.Size; n++)
+                if (g.Windows[n]->WasActive)
+                    windows.push_back(g.Windows[n]);
+            if (windows.Size > 1)
+                ImQsort(windows.Data, (size_t)windows.Size, sizeof(ImGuiWindow*), Funcs::ProfilerWindowCompareByTotalTime);
+            for (int n = 0; n < windows.Size; n++)
+                ImGui::BulletText("%7.3f ms (Begin() %.3f ms) '%s'", windows[n]->ProfilerTimeTotal * 1000.0f, windows[n]->ProfilerTimeBegin * 1000.0f, windows[n]->Name);
+            ImGui::TreePop();
+        }
+#else
+        ImGui::TextDisabled("Enable '#define IMGUI_DEBUG_PROFILER' in imconfig.h to record timings.");
+#endif
+        ImGui::TreePop();
+    }
+
+    // Heap allocations
+    if (ImGui::TreeNode("Allocations", "Allocations (%d during last frame)", g.MemStatsLastFrame.AllocCount))
+    {
+        const ImGuiMemStats& stats = g.MemStatsLastFrame;
+        ImGui::Text("Last frame: %d allocations (%d bytes), %d frees", stats.AllocCount, (int)stats.AllocBytes, stats.FreeCount);
+#ifdef IMGUI_DEBUG_ALLOCATIONS
+        const char* tag_names[] = { "Other", "DrawList", "Storage", "TextBuffer", "InputText", "Settings" };
+        IM_ASSERT(IM_ARRAYSIZE(tag_names) == ImGuiMemTag_COUNT);
+        for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+            ImGui::BulletText("%-10s %5d allocations, %8d bytes", tag_names[tag], stats.TagAllocCount[tag], (int)stats.TagAllocBytes[tag]);
+#else
+        ImGui::TextDisabled("Enable '#define IMGUI_DEBUG_ALLOCATIONS' in imconfig.h to attribute allocations to call-sites.");
+#endif
+        if (g.DebugAllocAssertAfterFrame >= 0)
+        {
+            ImGui::Text("Asserting on allocations after frame %d.", g.DebugAllocAssertAfterFrame);
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Stop"))
+                g.DebugAllocAssertAfterFrame = -1;
+        }
+        else
+        {
+            if (ImGui::SmallButton("Assert on allocations after 60 frames"))
+                ImGui::DebugStartAllocationAssert(60);
+            ImGui::SameLine();
+            MetricsHelpMarker("Will call IM_ASSERT() on any heap allocation made after the warm-up frames, to verify that a steady UI doesn't allocate.\nNote that interacting with this window (e.g. opening tree nodes) may allocate.");
+        }
+        ImGui::TreePop();
+    }
+
     // Misc Details
     if (ImGui::TreeNode("Internal state"))
     {
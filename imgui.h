@@ -30,7 +30,7 @@ Index of this file:
 // Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // Obsolete functions
 // Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
-// Draw List API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// Draw List API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFragment, ImDrawListFlags, ImDrawList, ImDrawData)
 // Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 
 */
@@ -115,9 +115,10 @@ struct ImDrawChannel;               // Temporary storage to output draw commands
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
+struct ImDrawListFragment;          // Recorded range of a draw list output, which can be appended again to any draw list without tessellating again.
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
@@ -148,8 +149,10 @@ typedef int ImGuiKey;               // -> enum ImGuiKey_             // Enum: A
 typedef int ImGuiNavInput;          // -> enum ImGuiNavInput_        // Enum: An input identifier for navigation
 typedef int ImGuiMouseButton;       // -> enum ImGuiMouseButton_     // Enum: A mouse button identifier (0=left, 1=right, 2=middle)
 typedef int ImGuiMouseCursor;       // -> enum ImGuiMouseCursor_     // Enum: A mouse cursor identifier
+typedef int ImGuiProfilerPhase;     // -> enum ImGuiProfilerPhase_   // Enum: A profiler phase identifier for GetProfilerPhaseTime()
 typedef int ImGuiStyleVar;          // -> enum ImGuiStyleVar_        // Enum: A variable identifier for styling
 typedef int ImDrawCornerFlags;      // -> enum ImDrawCornerFlags_    // Flags: for ImDrawList::AddRect(), AddRectFilled() etc.
+typedef int ImDrawLineFlags;        // -> enum ImDrawLineFlags_      // Flags: for ImDrawList::AddLine(), AddPolyline(), PathStroke()
 typedef int ImDrawListFlags;        // -> enum ImDrawListFlags_      // Flags: for ImDrawList
 typedef int ImFontAtlasFlags;       // -> enum ImFontAtlasFlags_     // Flags: for ImFontAtlas build
 typedef int ImGuiBackendFlags;      // -> enum ImGuiBackendFlags_    // Flags: for io.BackendFlags
@@ -275,8 +278,8 @@ namespace ImGui
     //   which clicking will set the boolean to false when clicked.
     // - You may append multiple times to the same window during the same frame by calling Begin()/End() pairs multiple times.
     //   Some information such as 'flags' or 'p_open' will only be considered by the first call to Begin().
-    // - Begin() return false to indicate the window is collapsed or fully clipped, so you may early out and omit submitting
-    //   anything to the window. Always call a matching End() for each Begin() call, regardless of its return value!
+    // - Begin() return false to indicate the window is collapsed, fully clipped or reusing last frame contents (ImGuiWindowFlags_CacheContents),
+    //   so you may early out and omit submitting anything to the window. Always call a matching End() for each Begin() call, regardless of its return value!
     //   [Important: due to legacy reason, this is inconsistent with most other functions such as BeginMenu/EndMenu,
     //    BeginPopup/EndPopup, etc. where the EndXXX call should only be called if the corresponding BeginXXX function
     //    returned true. Begin and BeginChild are the only odd ones out. Will be fixed in a future update.]
@@ -313,6 +316,7 @@ namespace ImGui
     IMGUI_API void          SetNextWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                 // set next window collapsed state. call before Begin()
     IMGUI_API void          SetNextWindowFocus();                                                       // set next window to be focused / top-most. call before Begin()
     IMGUI_API void          SetNextWindowBgAlpha(float alpha);                                          // set next window background color alpha. helper to easily override the Alpha component of ImGuiCol_WindowBg/ChildBg/PopupBg. you may also use ImGuiWindowFlags_NoBackground.
+    IMGUI_API void          SetNextWindowContentToken(ImGuiID token);                                   // set next window content token (e.g. a version counter or a hash of the displayed data). a ImGuiWindowFlags_CacheContents window submits its contents again when it changes. call before Begin()
     IMGUI_API void          SetWindowPos(const ImVec2& pos, ImGuiCond cond = 0);                        // (not recommended) set current window position - call within Begin()/End(). prefer using SetNextWindowPos(), as this may incur tearing and side-effects.
     IMGUI_API void          SetWindowSize(const ImVec2& size, ImGuiCond cond = 0);                      // (not recommended) set current window size - call within Begin()/End(). set to ImVec2(0, 0) to force an auto-fit. prefer using SetNextWindowSize(), as this may incur tearing and minor side-effects.
     IMGUI_API void          SetWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                     // (not recommended) set current window collapsed state. prefer using SetNextWindowCollapsed().
@@ -715,6 +719,9 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
+    IMGUI_API ImDrawListSharedData* CreateDrawListSharedData();                                 // create a copy of GetDrawListSharedData() for ImDrawList instances filled on other threads (see "Multi-threading" above ImDrawList).
+    IMGUI_API void          UpdateDrawListSharedData(ImDrawListSharedData* data);               // refresh a copy from the current context (fonts, atlas, style). call from the main thread while no other thread is using it, e.g. after NewFrame().
+    IMGUI_API void          DestroyDrawListSharedData(ImDrawListSharedData* data);
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage();
@@ -776,6 +783,7 @@ namespace ImGui
 
     // Debug Utilities
     IMGUI_API bool          DebugCheckVersionAndDataLayout(const char* version_str, size_t sz_io, size_t sz_style, size_t sz_vec2, size_t sz_vec4, size_t sz_drawvert, size_t sz_drawidx); // This is called by IMGUI_CHECKVERSION() macro.
+    IMGUI_API float         GetProfilerPhaseTime(ImGuiProfilerPhase phase, int frames_ago = 0); // time spent in given phase, in milliseconds. frames_ago=0 is the current (or last rendered) frame. Requires '#define IMGUI_DEBUG_PROFILER' in imconfig.h, otherwise always returns 0.0f.
 
     // Memory Allocators
     // - All those functions are not reliant on the current context.
@@ -814,6 +822,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 18,  // No gamepad/keyboard navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 19,  // No focusing toward this window with gamepad/keyboard navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 20,  // Append '*' to title without affecting the ID, as a convenience to avoid using the ### operator. When used in a tab/docking context, tab is selected on closure and closure is deferred by one frame to allow code to cancel the closure (with a confirmation popup, etc.) without flicker.
+    ImGuiWindowFlags_CacheContents          = 1 << 21,  // [BETA] Reuse last frame contents while the window is idle (not hovered, focused, active, moved, resized or scrolled, same content token): Begin() returns false and you should skip submitting contents. Use SetNextWindowContentToken() to notify data changes. Ignored on child windows and popups.
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -1335,6 +1344,32 @@ enum ImGuiMouseCursor_
 #endif
 };
 
+// Enumeration for GetProfilerPhaseTime()
+// Timings are only recorded when '#define IMGUI_DEBUG_PROFILER' is enabled in imconfig.h. Nested phases are included in their parent phase.
+enum ImGuiProfilerPhase_
+{
+    ImGuiProfilerPhase_Frame = 0,                   // Whole frame: from the start of NewFrame() to the end of Render()
+    ImGuiProfilerPhase_NewFrame,                    // NewFrame()
+    ImGuiProfilerPhase_NavUpdate,                   // Gamepad/keyboard navigation update, part of NewFrame() (includes scoring from the previous frame request)
+    ImGuiProfilerPhase_UpdateHoveredWindow,         // Hovered window search and io.WantCaptureXXX update, part of NewFrame()
+    ImGuiProfilerPhase_SaveIniSettings,             // SaveIniSettingsToMemory() or SaveIniSettingsToDisk(), typically part of NewFrame() after io.IniSavingRate
+    ImGuiProfilerPhase_Begin,                       // All Begin() calls (total over all windows)
+    ImGuiProfilerPhase_End,                         // All End() calls (total over all windows)
+    ImGuiProfilerPhase_EndFrame,                    // EndFrame()
+    ImGuiProfilerPhase_EndFrameSortWindows,         // Sorting of the window list, part of EndFrame()
+    ImGuiProfilerPhase_Render,                      // Render()
+    ImGuiProfilerPhase_AddRootWindowsToDrawData,    // Gathering of window draw lists into ImDrawData, part of Render()
+    ImGuiProfilerPhase_DrawDataFlatten,             // Merging of all draw lists into one when io.ConfigDrawDataFlatten is set, part of Render()
+    ImGuiProfilerPhase_DrawDataDamage,              // Comparison with the previous frame when io.ConfigDrawDataDamageRects is set, part of Render()
+    ImGuiProfilerPhase_DrawDataListHashes,          // Hashing of draw list contents when io.ConfigDrawDataListHashes is set, part of Render()
+    ImGuiProfilerPhase_FontAtlasBuild,              // ImFontAtlas::Build() or ImGuiFreeType::BuildFontAtlas(), typically called before the first frame
+    ImGuiProfilerPhase_FontAtlasGlyphLookup,        // Checking the presence of requested codepoints in the source fonts, part of FontAtlasBuild
+    ImGuiProfilerPhase_FontAtlasPackRects,          // Measuring and packing glyph rectangles, part of FontAtlasBuild
+    ImGuiProfilerPhase_FontAtlasRasterize,          // Rasterizing glyphs into the texture, part of FontAtlasBuild
+    ImGuiProfilerPhase_FontAtlasFinish,             // Registering glyphs into ImFont and ImFontAtlasBuildFinish(), part of FontAtlasBuild
+    ImGuiProfilerPhase_COUNT
+};
+
 // Enumeration for ImGui::SetWindow***(), SetNextWindow***(), SetNextItem***() functions
 // Represent a condition.
 // Important: Treat as a regular enum! Do NOT combine multiple values using binary operators! All the functions above treat 0 as a shortcut to ImGuiCond_Always.
@@ -1478,7 +1513,8 @@ struct ImGuiStyle
     bool        AntiAliasedLines;           // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders using textures where possible. Require back-end to render with bilinear filtering. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedFill;            // Enable anti-aliased edges around filled shapes (rounded rectangles, circles, etc.). Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
-    float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
+    bool        AntiAliasedRoundCornersUseTex; // Enable anti-aliased rounded rectangles and circles using textures where possible. Require back-end to render with bilinear filtering. Latched at the beginning of the frame (copied to ImDrawList).
+    float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo()/PathBezierQuadraticCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     float       CircleSegmentMaxError;      // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
     ImVec4      Colors[ImGuiCol_COUNT];
 
@@ -1526,6 +1562,9 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
     float       ConfigWindowsMemoryCompactTimer;// = 60.0f          // [BETA] Compact window memory usage when unused. Set to -1.0f to disable.
+    bool        ConfigDrawDataFlatten;          // = false          // [BETA] Output a single ImDrawList in ImDrawData, merging consecutive commands across windows, so the renderer back-end uploads one vertex/index buffer and issues fewer draw calls. Costs a copy of all vertices/indices on the CPU. With 16-bit indices and more than 64K vertices, requires (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset), otherwise draw lists are output as usual.
+    bool        ConfigDrawDataDamageRects;      // = false          // [BETA] Compare the output of Render() with the previous frame and list the changed screen areas in ImDrawData::DamageRects, so the renderer back-end or compositor can redraw and present only those. Costs hashing all triangles on the CPU.
+    bool        ConfigDrawDataListHashes;       // = false          // [BETA] Hash the vertices/indices of each draw list in ImDrawData (ImDrawList::ContentHash, ImDrawList::ContentChanged), so the renderer back-end can keep unchanged draw lists resident on the GPU instead of uploading them every frame. Costs hashing all vertices/indices on the CPU. Not useful with io.ConfigDrawDataFlatten, as the single draw list changes whenever any window does.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1598,7 +1637,7 @@ struct ImGuiIO
     int         MetricsRenderIndices;           // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
-    int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts, or if buffers are allocated and freed on different threads (see ImDrawList).
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     //------------------------------------------------------------------
@@ -1948,7 +1987,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// Draw List API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// Draw List API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFragment, ImDrawListFlags, ImDrawList, ImDrawData)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
@@ -1957,6 +1996,11 @@ struct ImColor
 #define IM_DRAWLIST_TEX_LINES_WIDTH_MAX     (63)
 #endif
 
+// The maximum rounding/circle radius to bake anti-aliased corner textures for. Build atlas with ImFontAtlasFlags_NoBakedRoundCorners to disable baking.
+#ifndef IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX
+#define IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX    (32)
+#endif
+
 // ImDrawCallback: Draw callbacks for advanced uses [configurable type: override in imconfig.h]
 // NB: You most likely do NOT need to use draw callbacks just to create your own widget or customized UI rendering,
 // you can poke into the draw list for that! Draw callback may be useful for example to:
@@ -1999,17 +2043,48 @@ struct ImDrawCmd
 typedef unsigned short ImDrawIdx;
 #endif
 
+// Compact vertex layout (12 bytes instead of 20), enable with '#define IMGUI_USE_COMPACT_DRAWVERT' in imconfig.h.
+// - Positions are stored as signed 16-bit fixed point with IM_DRAWVERT_POS_FRAC_BITS fractional bits (default 3: 1/8 pixel precision
+//   within [-4096,+4096), positions outside of that range are clamped). Renderer back-ends need to scale them by 1.0f/(1<<IM_DRAWVERT_POS_FRAC_BITS).
+// - UV are stored as unsigned 16-bit normalized values, UV outside of [0,1] are clamped.
+// - Both are written and read as ImVec2, the conversion happens on assignment.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#ifndef IM_DRAWVERT_POS_FRAC_BITS
+#define IM_DRAWVERT_POS_FRAC_BITS   3
+#endif
+struct ImDrawVertPos16
+{
+    short   x, y;
+    ImDrawVertPos16& operator=(const ImVec2& v) { x = Pack(v.x); y = Pack(v.y); return *this; }
+    operator ImVec2() const                     { return ImVec2(x * (1.0f / (1 << IM_DRAWVERT_POS_FRAC_BITS)), y * (1.0f / (1 << IM_DRAWVERT_POS_FRAC_BITS))); }
+    static short Pack(float f)                  { f *= (float)(1 << IM_DRAWVERT_POS_FRAC_BITS); return (short)(f <= -32768.0f ? -32768.0f : f >= 32767.0f ? 32767.0f : (f >= 0.0f ? f + 0.5f : f - 0.5f)); }
+};
+struct ImDrawVertUV16
+{
+    unsigned short  x, y;
+    ImDrawVertUV16& operator=(const ImVec2& v)  { x = Pack(v.x); y = Pack(v.y); return *this; }
+    operator ImVec2() const                     { return ImVec2(x * (1.0f / 65535.0f), y * (1.0f / 65535.0f)); }
+    static unsigned short Pack(float f)         { return (unsigned short)(f <= 0.0f ? 0.0f : f >= 1.0f ? 65535.0f : f * 65535.0f + 0.5f); }
+};
+#endif
+
 // Vertex layout
 #ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
 struct ImDrawVert
 {
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ImDrawVertPos16 pos;
+    ImDrawVertUV16  uv;
+#else
     ImVec2  pos;
     ImVec2  uv;
+#endif
     ImU32   col;
 };
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
+// With IMGUI_USE_COMPACT_DRAWVERT, the code expects ImDrawVertPos16 pos and ImDrawVertUV16 uv instead.
 // The type has to be described within the macro (you can either declare the struct or use a typedef). This is because ImVec2/ImU32 are likely not declared a the time you'd want to set your type up.
 // NOTE: IMGUI DOESN'T CLEAR THE STRUCTURE AND DOESN'T CALL A CONSTRUCTOR SO ANY CUSTOM FIELD WILL BE UNINITIALIZED. IF YOU ADD EXTRA FIELDS (SUCH AS A 'Z' COORDINATES) YOU WILL NEED TO CLEAR THEM DURING RENDER OR TO IGNORE THEM.
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
@@ -2039,6 +2114,61 @@ struct ImDrawListSplitter
     IMGUI_API void              SetCurrentChannel(ImDrawList* draw_list, int channel_idx);
 };
 
+// Recorded range of ImDrawList output (vertices, indices and commands with their texture/clip rectangle), which can be appended
+// again to any ImDrawList with ImDrawList::AddFragment(), e.g. in later frames, instead of submitting and tessellating the same shapes.
+// - Call Begin(draw_list), submit shapes to draw_list as usual, then End(draw_list) to copy their output into the fragment.
+// - Don't change channel (ImDrawListSplitter::SetCurrentChannel()) between Begin() and End().
+// - Vertex positions and clip rectangles are stored as submitted, AddFragment() can translate them.
+struct ImDrawListFragment
+{
+    ImVector<ImDrawCmd>         CmdBuffer;      // Draw commands. IdxOffset/VtxOffset are relative to the fragment's own buffers
+    ImVector<ImDrawIdx>         IdxBuffer;      // Index buffer, each command consume ImDrawCmd::ElemCount of those
+    ImVector<ImDrawVert>        VtxBuffer;      // Vertex buffer
+    ImDrawList*                 _DrawList;      // [Internal] draw list being recorded, between Begin() and End()
+    int                         _BeginCmd;      // [Internal] CmdBuffer.Size - 1 of the draw list on Begin()
+    int                         _BeginIdx;      // [Internal] IdxBuffer.Size of the draw list on Begin()
+    int                         _BeginVtx;      // [Internal] VtxBuffer.Size of the draw list on Begin()
+
+    ImDrawListFragment()        { _DrawList = NULL; _BeginCmd = _BeginIdx = _BeginVtx = 0; }
+    void                        Clear() { CmdBuffer.resize(0); IdxBuffer.resize(0); VtxBuffer.resize(0); } // Keep allocations so they can be reused when recording again
+    void                        ClearFreeMemory() { CmdBuffer.clear(); IdxBuffer.clear(); VtxBuffer.clear(); }
+    bool                        IsEmpty() const { return CmdBuffer.Size == 0; }
+    IMGUI_API void              Begin(ImDrawList* draw_list);
+    IMGUI_API void              End(ImDrawList* draw_list);
+};
+
+// [Internal] State saved by ImDrawList::PushTransform() and restored by ImDrawList::PopTransform()
+struct ImDrawListTransform
+{
+    ImVec2                      Translation;
+    float                       Scale;
+    float                       RotationCos, RotationSin;
+    float                       BackupFringeScale;
+    ImVec4                      BackupClipRect;     // Clip rectangle before PushTransform(), transformed clip rectangles are intersected with it
+    ImVec4                      ClipRect;           // Same in canvas coordinates
+    int                         VtxBufferSize;      // VtxBuffer.Size on PushTransform(), following vertices are transformed by PopTransform()
+    int                         CmdBufferIdx;       // First command whose clip rectangle is transformed by PopTransform()
+    int                         ClipRectStackSize;
+    int                         ChannelsCount, ChannelsCurrent;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ImVec2                      EmitTranslation;    // Combined with the outer transforms, applied to vertices as they are written (see IM_DRAWLIST_EMIT_POS())
+    float                       EmitM00, EmitM01, EmitM10, EmitM11;
+    ImVec2                      EmitPos(const ImVec2& p) const { return ImVec2(EmitTranslation.x + p.x * EmitM00 + p.y * EmitM01, EmitTranslation.y + p.x * EmitM10 + p.y * EmitM11); }
+    ImVec2                      EmitPosInverse(const ImVec2& p) const { const float inv_det = 1.0f / (EmitM00 * EmitM11 - EmitM01 * EmitM10); const ImVec2 d(p.x - EmitTranslation.x, p.y - EmitTranslation.y); return ImVec2((d.x * EmitM11 - d.y * EmitM01) * inv_det, (d.y * EmitM00 - d.x * EmitM10) * inv_det); }
+#endif
+};
+
+// Position to write into a vertex of a draw list, e.g. '_VtxWritePtr->pos = IM_DRAWLIST_EMIT_POS(draw_list, pos)', and back (IM_DRAWLIST_READ_POS()).
+// With IMGUI_USE_COMPACT_DRAWVERT the current transform (see PushTransform()) is applied here rather than by PopTransform(),
+// as 16-bit positions in canvas coordinates would lose range when zoomed out and precision when zoomed in.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#define IM_DRAWLIST_EMIT_POS(_DRAWLIST, _POS)   ((_DRAWLIST)->_EmitTransform ? (_DRAWLIST)->_EmitTransform->EmitPos(_POS) : (ImVec2)(_POS))
+#define IM_DRAWLIST_READ_POS(_DRAWLIST, _POS)   ((_DRAWLIST)->_EmitTransform ? (_DRAWLIST)->_EmitTransform->EmitPosInverse(_POS) : (ImVec2)(_POS))
+#else
+#define IM_DRAWLIST_EMIT_POS(_DRAWLIST, _POS)   (_POS)
+#define IM_DRAWLIST_READ_POS(_DRAWLIST, _POS)   (_POS)
+#endif
+
 enum ImDrawCornerFlags_
 {
     ImDrawCornerFlags_None      = 0,
@@ -2053,6 +2183,23 @@ enum ImDrawCornerFlags_
     ImDrawCornerFlags_All       = 0xF     // In your function calls you may use ~0 (= all bits sets) instead of ImDrawCornerFlags_All, as a convenience
 };
 
+// Flags for ImDrawList::AddLine(), AddPolyline(), PathStroke()
+// - With no flags, thick lines are drawn with the legacy tessellation: joints are averaged normals (which thin out at sharp angles), ends are cut square.
+// - Any join or cap flag switches to proper joins and caps, drawn as a single mesh for any thickness (use instead of adding circles at joints).
+//   The default join is miter (beveled past IM_DRAWLIST_MITER_LIMIT) and the default cap is butt. Caps are ignored on closed polylines.
+enum ImDrawLineFlags_
+{
+    ImDrawLineFlags_None        = 0,
+    ImDrawLineFlags_JoinMiter   = 1 << 0,   // Extend outer edges to meet at a point
+    ImDrawLineFlags_JoinBevel   = 1 << 1,   // Cut outer corners straight
+    ImDrawLineFlags_JoinRound   = 1 << 2,   // Round outer corners, tessellated like a circle of the same thickness
+    ImDrawLineFlags_CapButt     = 1 << 3,   // End exactly on the first/last points
+    ImDrawLineFlags_CapSquare   = 1 << 4,   // Extend by half the thickness past the first/last points
+    ImDrawLineFlags_CapRound    = 1 << 5,   // Extend by a half circle past the first/last points
+    ImDrawLineFlags_JoinMask_   = ImDrawLineFlags_JoinMiter | ImDrawLineFlags_JoinBevel | ImDrawLineFlags_JoinRound,
+    ImDrawLineFlags_CapMask_    = ImDrawLineFlags_CapButt | ImDrawLineFlags_CapSquare | ImDrawLineFlags_CapRound
+};
+
 // Flags for ImDrawList. Those are set automatically by ImGui:: functions from ImGuiIO settings, and generally not manipulated directly.
 // It is however possible to temporarily alter flags between calls to ImDrawList:: functions.
 enum ImDrawListFlags_
@@ -2061,7 +2208,9 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLines        = 1 << 0,  // Enable anti-aliased lines/borders (*2 the number of triangles for 1.0f wide line or lines thin enough to be drawn using textures, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require back-end to render with bilinear filtering.
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
-    ImDrawListFlags_AllowVtxOffset          = 1 << 3   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AntiAliasedRoundCornersUseTex = 1 << 4, // Enable anti-aliased rounded rectangles and circles using textures when possible (filled, or 1.0f thick borders). Require back-end to render with bilinear filtering.
+    ImDrawListFlags_CullClipped             = 1 << 5   // Skip primitives whose bounding box is fully outside of the current clip rectangle (coarse CPU culling). Set by default. Clear it if you alter ImDrawCmd::ClipRect after submitting primitives.
 };
 
 // Draw command list
@@ -2071,7 +2220,15 @@ enum ImDrawListFlags_
 // access the current window draw list and draw custom primitives.
 // You can interleave normal ImGui:: calls and adding primitives to the current draw list.
 // All positions are generally in pixel coordinates (top-left at (0,0), bottom-right at io.DisplaySize), but you are totally free to apply whatever transformation matrix to want to the data (if you apply such transformation you'll want to apply it to ClipRect as well)
-// Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects.
+// Important: Primitives are only culled when fully outside of the current clip rectangle (see ImDrawListFlags_CullClipped), culling is otherwise done at higher-level by ImGui:: functions. If you use this API a lot consider coarse culling your drawn objects.
+// Multi-threading: you may fill your own ImDrawList instances on other threads (one thread per draw list at a time), then append them on the main thread.
+// - Create them with a copy made by ImGui::CreateDrawListSharedData(), as GetDrawListSharedData() is modified by ImGui:: functions (e.g. PushFont()).
+//   Call ImGui::UpdateDrawListSharedData() every frame while no worker is running, then on the worker call _ResetForNewFrame(), PushTextureID(font texture)
+//   and PushClipRect() before adding primitives. Don't call any ImGui:: function from the worker.
+// - Append them with ImDrawList::AddDrawList() (e.g. into ImGui::GetWindowDrawList()) or, after ImGui::Render(), with ImDrawData::AddDrawList().
+// - Heap allocations made on worker threads go through ImGui::MemAlloc() but are not counted in Metrics, which only counts allocations
+//   made on the thread running NewFrame() (when the compiler supports IM_THREAD_LOCAL, see imgui_internal.h). io.MetricsActiveAllocations
+//   therefore drifts when a buffer grown on a worker is freed on that thread (e.g. by destroying the ImDrawList), or the other way around.
 struct ImDrawList
 {
     // This is what you have to render
@@ -2079,6 +2236,8 @@ struct ImDrawList
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
+    ImU32                   ContentHash;        // Hash of VtxBuffer and IdxBuffer, set by ImGui::Render() when io.ConfigDrawDataListHashes is set, otherwise 0. Renderer back-ends may keep the buffers of a draw list on the GPU until its hash changes.
+    bool                    ContentChanged;     // Set by ImGui::Render(): VtxBuffer or IdxBuffer changed since the last frame this draw list was rendered. Always true when ContentHash is 0.
 
     // [Internal, used while building lists]
     const ImDrawListSharedData* _Data;          // Pointer to shared draw data (you can use ImGui::GetDrawListSharedData() to get the one from current ImGui context)
@@ -2091,12 +2250,23 @@ struct ImDrawList
     ImVector<ImVec2>        _Path;              // [Internal] current path building
     ImDrawCmd               _CmdHeader;         // [Internal] Template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
+    ImVector<ImDrawListTransform> _TransformStack; // [Internal] see PushTransform()
+    float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value: 1.0f / scale of the current transform, so fringes stay 1 pixel wide on screen
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const ImDrawListTransform* _EmitTransform;  // [Internal] top of _TransformStack or NULL, see IM_DRAWLIST_EMIT_POS()
+#endif
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
-    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; Flags = ImDrawListFlags_None; _VtxCurrentIdx = 0; _VtxWritePtr = NULL; _IdxWritePtr = NULL; _OwnerName = NULL; }
+    ImDrawList(const ImDrawListSharedData* shared_data)
+    {
+        _Data = shared_data; Flags = ImDrawListFlags_None; ContentHash = 0; ContentChanged = true; _VtxCurrentIdx = 0; _VtxWritePtr = NULL; _IdxWritePtr = NULL; _OwnerName = NULL; _FringeScale = 1.0f;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        _EmitTransform = NULL;
+#endif
+    }
 
     ~ImDrawList() { _ClearFreeMemory(); }
-    IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
+    IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function, and used to skip fully clipped primitives when ImDrawListFlags_CullClipped is set. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
     IMGUI_API void  PushClipRectFullScreen();
     IMGUI_API void  PopClipRect();
     IMGUI_API void  PushTextureID(ImTextureID texture_id);
@@ -2104,13 +2274,26 @@ struct ImDrawList
     inline ImVec2   GetClipRectMin() const { const ImVec4& cr = _ClipRectStack.back(); return ImVec2(cr.x, cr.y); }
     inline ImVec2   GetClipRectMax() const { const ImVec4& cr = _ClipRectStack.back(); return ImVec2(cr.z, cr.w); }
 
+    // Transform, e.g. for zoomable canvases
+    // - Primitives added between PushTransform() and PopTransform() use canvas coordinates, drawn at 'translation + rotate(pos * scale, rotation)'
+    //   on screen (rotation in radians, clockwise as Y goes down). Thicknesses, rounding and font sizes are in canvas units too. Calls can be nested.
+    // - Clip rectangles pushed in between are in canvas coordinates. Vertices and clip rectangles are transformed once, by PopTransform().
+    //   With IMGUI_USE_COMPACT_DRAWVERT, vertices are transformed as they are written instead (see IM_DRAWLIST_EMIT_POS()), so their 16-bit
+    //   range and precision apply to screen coordinates. Code writing _VtxWritePtr directly needs to do the same.
+    // - Curves, circles and rounded corners are tessellated for their size on screen, and anti-aliased fringes stay 1 pixel wide
+    //   (texture-based anti-aliasing of lines and round corners is not used unless the scale is 1.0f).
+    // - Only affects this draw list: ImGui:: items, hit-testing and window clip rectangles are not transformed.
+    //   Don't change channel or call ChannelsMerge() between PushTransform() and PopTransform() unless the channels were split in between.
+    IMGUI_API void  PushTransform(const ImVec2& translation, float scale, float rotation = 0.0f);
+    IMGUI_API void  PopTransform();
+
     // Primitives
     // - For rectangular primitives, "p_min" and "p_max" represent the upper-left and lower-right corners.
     // - For circle primitives, use "num_segments == 0" to automatically calculate tessellation (preferred).
     //   In older versions (until Dear ImGui 1.77) the AddCircle functions defaulted to num_segments == 12.
     //   In future versions we will use textures to provide cheaper and higher-quality circles.
     //   Use AddNgon() and AddNgonFilled() functions if you need to guaranteed a specific number of sides.
-    IMGUI_API void  AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness = 1.0f);
+    IMGUI_API void  AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness = 1.0f, ImDrawLineFlags flags = 0);
     IMGUI_API void  AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f, ImDrawCornerFlags rounding_corners = ImDrawCornerFlags_All, float thickness = 1.0f);   // a: upper-left, b: lower-right (== upper-left + size), rounding_corners_flags: 4 bits corresponding to which corner to round
     IMGUI_API void  AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f, ImDrawCornerFlags rounding_corners = ImDrawCornerFlags_All);                     // a: upper-left, b: lower-right (== upper-left + size)
     IMGUI_API void  AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_max, ImU32 col_upr_left, ImU32 col_upr_right, ImU32 col_bot_right, ImU32 col_bot_left);
@@ -2124,9 +2307,10 @@ struct ImDrawList
     IMGUI_API void  AddNgonFilled(const ImVec2& center, float radius, ImU32 col, int num_segments);
     IMGUI_API void  AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL);
     IMGUI_API void  AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL);
-    IMGUI_API void  AddPolyline(const ImVec2* points, int num_points, ImU32 col, bool closed, float thickness);
+    IMGUI_API void  AddPolyline(const ImVec2* points, int num_points, ImU32 col, bool closed, float thickness, ImDrawLineFlags flags = 0);
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col); // Note: Anti-aliased filling requires points to be in clockwise order.
-    IMGUI_API void  AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0);
+    IMGUI_API void  AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0); // Cubic Bezier (4 control points)
+    IMGUI_API void  AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments = 0);                // Quadratic Bezier (3 control points)
 
     // Image primitives
     // - Read FAQ to understand what ImTextureID is.
@@ -2136,15 +2320,35 @@ struct ImDrawList
     IMGUI_API void  AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& uv1 = ImVec2(0, 0), const ImVec2& uv2 = ImVec2(1, 0), const ImVec2& uv3 = ImVec2(1, 1), const ImVec2& uv4 = ImVec2(0, 1), ImU32 col = IM_COL32_WHITE);
     IMGUI_API void  AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners = ImDrawCornerFlags_All);
 
+    // Batched primitives
+    // - Same output as calling AddRectFilled() (without rounding), AddLine(), AddCircleFilled() or AddImage() for each shape, with a single
+    //   PrimReserve() per batch instead of one per shape. With 16-bit indices, batches are split where individual calls would cross 64K vertices.
+    // - Same output as calling AddBezierCurve() for each curve, except that curves entirely outside of the current clip rectangle are skipped.
+    // - "rects" and "uvs" hold (min, max) pairs and "lines" hold (p1, p2) pairs: rects[i * 2 + 0], rects[i * 2 + 1] for the i-th shape.
+    // - "curves" hold 4 control points per curve: curves[i * 4 + 0] to curves[i * 4 + 3] for the i-th curve.
+    // - "cols", "radii" and "uvs" hold one value per shape, or may be NULL to use "col", "radius", or (0,0)->(1,1) for all shapes.
+    IMGUI_API void  AddRectFilledBatch(const ImVec2* rects, int rects_count, const ImU32* cols, ImU32 col = IM_COL32_WHITE);
+    IMGUI_API void  AddLinesBatch(const ImVec2* lines, int lines_count, const ImU32* cols, ImU32 col = IM_COL32_WHITE, float thickness = 1.0f);
+    IMGUI_API void  AddCirclesFilledBatch(const ImVec2* centers, const float* radii, int circles_count, const ImU32* cols, ImU32 col = IM_COL32_WHITE, float radius = 1.0f, int num_segments = 0);
+    IMGUI_API void  AddImagesBatch(ImTextureID user_texture_id, const ImVec2* rects, const ImVec2* uvs, int images_count, const ImU32* cols, ImU32 col = IM_COL32_WHITE);
+    IMGUI_API void  AddBezierCurvesBatch(const ImVec2* curves, int curves_count, const ImU32* cols, ImU32 col = IM_COL32_WHITE, float thickness = 1.0f, int num_segments = 0);
+
+    // Recorded fragments (see ImDrawListFragment) and output of other draw lists
+    // - Vertices are copied (translated by 'offset') and indices rebased, without tessellating again.
+    // - Clip rectangles are translated by 'offset' and intersected with the current clip rectangle, use PushClipRect() to restrict them further.
+    IMGUI_API void  AddFragment(const ImDrawListFragment& fragment, const ImVec2& offset = ImVec2(0, 0));
+    IMGUI_API void  AddDrawList(const ImDrawList* draw_list, const ImVec2& offset = ImVec2(0, 0));  // Same for the output of another draw list, e.g. filled on another thread.
+
     // Stateful path API, add points then finish with PathFillConvex() or PathStroke()
     inline    void  PathClear()                                                 { _Path.Size = 0; }
     inline    void  PathLineTo(const ImVec2& pos)                               { _Path.push_back(pos); }
     inline    void  PathLineToMergeDuplicate(const ImVec2& pos)                 { if (_Path.Size == 0 || memcmp(&_Path.Data[_Path.Size - 1], &pos, 8) != 0) _Path.push_back(pos); }
     inline    void  PathFillConvex(ImU32 col)                                   { AddConvexPolyFilled(_Path.Data, _Path.Size, col); _Path.Size = 0; }  // Note: Anti-aliased filling requires points to be in clockwise order.
-    inline    void  PathStroke(ImU32 col, bool closed, float thickness = 1.0f)  { AddPolyline(_Path.Data, _Path.Size, col, closed, thickness); _Path.Size = 0; }
+    inline    void  PathStroke(ImU32 col, bool closed, float thickness = 1.0f, ImDrawLineFlags flags = 0) { AddPolyline(_Path.Data, _Path.Size, col, closed, thickness, flags); _Path.Size = 0; }
     IMGUI_API void  PathArcTo(const ImVec2& center, float radius, float a_min, float a_max, int num_segments = 10);
     IMGUI_API void  PathArcToFast(const ImVec2& center, float radius, int a_min_of_12, int a_max_of_12);                                            // Use precomputed angles for a 12 steps circle
-    IMGUI_API void  PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments = 0);
+    IMGUI_API void  PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments = 0);                                  // Cubic Bezier (4 control points)
+    IMGUI_API void  PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3, int num_segments = 0);                                           // Quadratic Bezier (3 control points)
     IMGUI_API void  PathRect(const ImVec2& rect_min, const ImVec2& rect_max, float rounding = 0.0f, ImDrawCornerFlags rounding_corners = ImDrawCornerFlags_All);
 
     // Advanced
@@ -2170,7 +2374,7 @@ struct ImDrawList
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
-    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
+    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = IM_DRAWLIST_EMIT_POS(this, pos); _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
@@ -2181,6 +2385,7 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _PrimConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col);
 };
 
 // All draw data to render a Dear ImGui frame
@@ -2196,13 +2401,17 @@ struct ImDrawData
     ImVec2          DisplayPos;             // Upper-left position of the viewport to render (== upper-left of the orthogonal projection matrix to use)
     ImVec2          DisplaySize;            // Size of the viewport to render (== io.DisplaySize for the main viewport) (DisplayPos + DisplaySize == lower-right of the orthogonal projection matrix to use)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
+    const ImVec4*   DamageRects;            // Rectangles (x1, y1, x2, y2, in the same space as ImDrawCmd::ClipRect) whose contents changed since the previous frame when io.ConfigDrawDataDamageRects is set, otherwise a single rectangle covering the display. Contents of your textures are not compared.
+    int             DamageRectsCount;       // Number of DamageRects. 0 when nothing changed.
 
     // Functions
     ImDrawData()    { Valid = false; Clear(); }
     ~ImDrawData()   { Clear(); }
-    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
+    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); DamageRects = NULL; DamageRectsCount = 0; } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to render one of your own draw lists after the ones of Dear ImGui (e.g. filled on another thread). Call on the ImDrawData returned by GetDrawData(), after Render(). The draw list needs to stay alive until rendered.
+    IMGUI_API bool  MergeCmdLists(ImDrawList* out_list, bool allow_vtx_offset) const; // Helper to copy all draw lists into a single one, merging consecutive commands sharing clip rectangle and texture. With 16-bit indices and more than 64K vertices this requires 'allow_vtx_offset', otherwise return false. Used by io.ConfigDrawDataFlatten.
 };
 
 //-----------------------------------------------------------------------------
@@ -2282,7 +2491,8 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2    // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedRoundCorners = 1 << 3   // Don't build round corner textures into the atlas (save a little texture memory). The AntiAliasedRoundCornersUseTex features uses them, otherwise rounded rectangles and circles will be rendered using polygons (more expensive for CPU/GPU).
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2384,10 +2594,13 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVec4                      TexUvRoundCornersFilled[IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX + 1];        // UVs for baked anti-aliased filled corners, indexed by radius (outer corner in xy, circle center in zw)
+    ImVec4                      TexUvRoundCornersStroked[IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2 + 2];   // UVs for baked anti-aliased 1 pixel wide stroked corners, indexed by outer radius * 2
 
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    int                         PackIdRoundCorners; // Custom texture rectangle ID of the first of baked anti-aliased round corners
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
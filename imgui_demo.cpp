@@ -404,6 +404,12 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::Checkbox("io.ConfigWindowsResizeFromEdges", &io.ConfigWindowsResizeFromEdges);
             ImGui::SameLine(); HelpMarker("Enable resizing of windows from their edges and from the lower-left corner.\nThis requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback.");
             ImGui::Checkbox("io.ConfigWindowsMoveFromTitleBarOnly", &io.ConfigWindowsMoveFromTitleBarOnly);
+            ImGui::Checkbox("io.ConfigDrawDataFlatten", &io.ConfigDrawDataFlatten);
+            ImGui::SameLine(); HelpMarker("Output a single draw list, merging consecutive draw commands across windows, so the renderer back-end uploads one vertex/index buffer and issues fewer draw calls.");
+            ImGui::Checkbox("io.ConfigDrawDataDamageRects", &io.ConfigDrawDataDamageRects);
+            ImGui::SameLine(); HelpMarker("Compare the output with the previous frame and list changed screen areas in ImDrawData::DamageRects, so the renderer back-end can redraw and present only those.");
+            ImGui::Checkbox("io.ConfigDrawDataListHashes", &io.ConfigDrawDataListHashes);
+            ImGui::SameLine(); HelpMarker("Hash the vertices/indices of each draw list (ImDrawList::ContentHash), so the renderer back-end can keep unchanged draw lists on the GPU instead of uploading them every frame.");
             ImGui::Checkbox("io.MouseDrawCursor", &io.MouseDrawCursor);
             ImGui::SameLine(); HelpMarker("Instruct Dear ImGui to render a mouse cursor itself. Note that a mouse cursor rendered via your application GPU rendering path will feel more laggy than hardware cursor, but will be more in sync with your other visuals.\n\nSome desktop applications may use both kinds of cursors (e.g. enable software cursor only when resizing/dragging something).");
             ImGui::Text("Also see Style->Rendering for rendering options.");
@@ -3613,6 +3619,9 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigWindowsMemoryCompactTimer >= 0.0f)                 ImGui::Text("io.ConfigWindowsMemoryCompactTimer = %.1ff", io.ConfigWindowsMemoryCompactTimer);
+        if (io.ConfigDrawDataFlatten)                                   ImGui::Text("io.ConfigDrawDataFlatten");
+        if (io.ConfigDrawDataDamageRects)                               ImGui::Text("io.ConfigDrawDataDamageRects");
+        if (io.ConfigDrawDataListHashes)                                ImGui::Text("io.ConfigDrawDataListHashes");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
@@ -3983,6 +3992,11 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
             HelpMarker("Faster lines using texture data. Require back-end to render with bilinear filtering (not point/nearest filtering).");
 
             ImGui::Checkbox("Anti-aliased fill", &style.AntiAliasedFill);
+
+            ImGui::Checkbox("Anti-aliased round corners use texture", &style.AntiAliasedRoundCornersUseTex);
+            ImGui::SameLine();
+            HelpMarker("Faster rounded rectangles and circles using texture data (filled, or with 1.0f thick borders). Require back-end to render with bilinear filtering (not point/nearest filtering).");
+
             ImGui::PushItemWidth(100);
             ImGui::DragFloat("Curve Tessellation Tolerance", &style.CurveTessellationTol, 0.02f, 0.10f, 10.0f, "%.2f");
             if (style.CurveTessellationTol < 0.10f) style.CurveTessellationTol = 0.10f;
@@ -5090,7 +5104,8 @@ static void ShowExampleAppCustomRendering(bool* p_open)
                 draw_list->AddLine(ImVec2(x, y), ImVec2(x + sz, y), col, th);                                       x += sz + spacing;  // Horizontal line (note: drawing a filled rectangle will be faster!)
                 draw_list->AddLine(ImVec2(x, y), ImVec2(x, y + sz), col, th);                                       x += spacing;       // Vertical line (note: drawing a filled rectangle will be faster!)
                 draw_list->AddLine(ImVec2(x, y), ImVec2(x + sz, y + sz), col, th);                                  x += sz + spacing;  // Diagonal line
-                draw_list->AddBezierCurve(ImVec2(x, y), ImVec2(x + sz*1.3f, y + sz*0.3f), ImVec2(x + sz - sz*1.3f, y + sz - sz*0.3f), ImVec2(x + sz, y + sz), col, th);
+                draw_list->AddBezierQuadratic(ImVec2(x, y + sz*0.6f), ImVec2(x + sz*0.5f, y - sz*0.4f), ImVec2(x + sz, y + sz), col, th);   x += sz + spacing;  // Quadratic Bezier (3 control points)
+                draw_list->AddBezierCurve(ImVec2(x, y), ImVec2(x + sz*1.3f, y + sz*0.3f), ImVec2(x + sz - sz*1.3f, y + sz - sz*0.3f), ImVec2(x + sz, y + sz), col, th); // Cubic Bezier (4 control points)
                 x = p.x + 4;
                 y += sz + spacing;
             }
@@ -5107,6 +5122,31 @@ static void ShowExampleAppCustomRendering(bool* p_open)
             draw_list->AddRectFilledMultiColor(ImVec2(x, y), ImVec2(x + sz, y + sz), IM_COL32(0, 0, 0, 255), IM_COL32(255, 0, 0, 255), IM_COL32(255, 255, 0, 255), IM_COL32(0, 255, 0, 255));
 
             ImGui::Dummy(ImVec2((sz + spacing) * 8.8f, (sz + spacing) * 3.0f));
+
+            // Draw the same polyline with each join style
+            ImGui::Text("Line joins and caps");
+            static float join_thickness = 12.0f;
+            static int join_cap = 0;
+            ImGui::DragFloat("Line thickness", &join_thickness, 0.05f, 1.0f, 64.0f, "%.02f");
+            ImGui::Combo("Caps", &join_cap, "Butt\0Square\0Round\0");
+            {
+                const ImDrawLineFlags join_flags[] = { ImDrawLineFlags_None, ImDrawLineFlags_JoinMiter, ImDrawLineFlags_JoinBevel, ImDrawLineFlags_JoinRound };
+                const char* join_names[] = { "No flags", "Miter", "Bevel", "Round" };
+                const ImDrawLineFlags cap_flags[] = { ImDrawLineFlags_CapButt, ImDrawLineFlags_CapSquare, ImDrawLineFlags_CapRound };
+                const ImVec2 lines_p = ImGui::GetCursorScreenPos();
+                const float margin = join_thickness;
+                const float w = sz * 2.5f, h = sz * 1.5f;
+                const float y0 = lines_p.y + ImGui::GetTextLineHeightWithSpacing() + margin;
+                for (int n = 0; n < IM_ARRAYSIZE(join_flags); n++)
+                {
+                    const float x0 = lines_p.x + margin + n * (w + margin * 2.0f);
+                    draw_list->AddText(ImVec2(x0 - margin, lines_p.y), ImGui::GetColorU32(ImGuiCol_Text), join_names[n]);
+                    const ImVec2 points[] = { ImVec2(x0, y0 + h), ImVec2(x0 + w * 0.25f, y0), ImVec2(x0 + w * 0.5f, y0 + h), ImVec2(x0 + w, y0 + h * 0.3f), ImVec2(x0 + w * 0.7f, y0 + h * 0.3f) };
+                    const ImDrawLineFlags flags = (join_flags[n] != ImDrawLineFlags_None) ? (join_flags[n] | cap_flags[join_cap]) : ImDrawLineFlags_None;
+                    draw_list->AddPolyline(points, IM_ARRAYSIZE(points), col, false, join_thickness, flags);
+                }
+                ImGui::Dummy(ImVec2(IM_ARRAYSIZE(join_flags) * (w + margin * 2.0f), ImGui::GetTextLineHeightWithSpacing() + h + margin * 2.0f));
+            }
             ImGui::PopItemWidth();
             ImGui::EndTabItem();
         }
@@ -5115,13 +5155,14 @@ static void ShowExampleAppCustomRendering(bool* p_open)
         {
             static ImVector<ImVec2> points;
             static ImVec2 scrolling(0.0f, 0.0f);
+            static float zoom = 1.0f;
             static bool opt_enable_grid = true;
             static bool opt_enable_context_menu = true;
             static bool adding_line = false;
 
             ImGui::Checkbox("Enable grid", &opt_enable_grid);
             ImGui::Checkbox("Enable context menu", &opt_enable_context_menu);
-            ImGui::Text("Mouse Left: drag to add lines,\nMouse Right: drag to scroll, click for context menu.");
+            ImGui::Text("Mouse Left: drag to add lines,\nMouse Right: drag to scroll, click for context menu,\nMouse Wheel: zoom.");
 
             // Typically you would use a BeginChild()/EndChild() pair to benefit from a clipping region + own scrolling.
             // Here we demonstrate that this can be replaced by simple offsetting + custom drawing + PushClipRect/PopClipRect() calls.
@@ -5152,7 +5193,7 @@ static void ShowExampleAppCustomRendering(bool* p_open)
             const bool is_hovered = ImGui::IsItemHovered(); // Hovered
             const bool is_active = ImGui::IsItemActive();   // Held
             const ImVec2 origin(canvas_p0.x + scrolling.x, canvas_p0.y + scrolling.y); // Lock scrolled origin
-            const ImVec2 mouse_pos_in_canvas(io.MousePos.x - origin.x, io.MousePos.y - origin.y);
+            const ImVec2 mouse_pos_in_canvas((io.MousePos.x - origin.x) / zoom, (io.MousePos.y - origin.y) / zoom);
 
             // Add first and second point
             if (is_hovered && !adding_line && ImGui::IsMouseClicked(ImGuiMouseButton_Left))
@@ -5177,6 +5218,14 @@ static void ShowExampleAppCustomRendering(bool* p_open)
                 scrolling.y += io.MouseDelta.y;
             }
 
+            // Zoom around the mouse cursor
+            if (is_hovered && io.MouseWheel != 0.0f)
+            {
+                zoom = IM_CLAMP(zoom * powf(1.2f, io.MouseWheel), 0.1f, 10.0f);
+                scrolling.x = io.MousePos.x - canvas_p0.x - mouse_pos_in_canvas.x * zoom;
+                scrolling.y = io.MousePos.y - canvas_p0.y - mouse_pos_in_canvas.y * zoom;
+            }
+
             // Context menu (under default mouse threshold)
             ImVec2 drag_delta = ImGui::GetMouseDragDelta(ImGuiMouseButton_Right);
             if (opt_enable_context_menu && ImGui::IsMouseReleased(ImGuiMouseButton_Right) && drag_delta.x == 0.0f && drag_delta.y == 0.0f)
@@ -5195,14 +5244,18 @@ static void ShowExampleAppCustomRendering(bool* p_open)
             draw_list->PushClipRect(canvas_p0, canvas_p1, true);
             if (opt_enable_grid)
             {
-                const float GRID_STEP = 64.0f;
+                const float GRID_STEP = 64.0f * zoom;
                 for (float x = fmodf(scrolling.x, GRID_STEP); x < canvas_sz.x; x += GRID_STEP)
                     draw_list->AddLine(ImVec2(canvas_p0.x + x, canvas_p0.y), ImVec2(canvas_p0.x + x, canvas_p1.y), IM_COL32(200, 200, 200, 40));
                 for (float y = fmodf(scrolling.y, GRID_STEP); y < canvas_sz.y; y += GRID_STEP)
                     draw_list->AddLine(ImVec2(canvas_p0.x, canvas_p0.y + y), ImVec2(canvas_p1.x, canvas_p0.y + y), IM_COL32(200, 200, 200, 40));
             }
+
+            // Lines are added in canvas coordinates and transformed by the draw list, which keeps anti-aliasing sharp at any zoom level
+            draw_list->PushTransform(origin, zoom);
             for (int n = 0; n < points.Size; n += 2)
-                draw_list->AddLine(ImVec2(origin.x + points[n].x, origin.y + points[n].y), ImVec2(origin.x + points[n + 1].x, origin.y + points[n + 1].y), IM_COL32(255, 255, 0, 255), 2.0f);
+                draw_list->AddLine(points[n], points[n + 1], IM_COL32(255, 255, 0, 255), 2.0f);
+            draw_list->PopTransform();
             draw_list->PopClipRect();
 
             ImGui::EndTabItem();
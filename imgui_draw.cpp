@@ -9,6 +9,7 @@ Index of this file:
 // [SECTION] Style functions
 // [SECTION] ImDrawList
 // [SECTION] ImDrawListSplitter
+// [SECTION] ImDrawListFragment
 // [SECTION] ImDrawData
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
@@ -48,6 +49,18 @@ Index of this file:
 #endif
 #endif
 
+// SSE2/NEON intrinsics for anti-aliased polyline tessellation (see IMGUI_DISABLE_SIMD in imconfig.h)
+// NEON is only used on AArch64, as ARMv7 NEON has no vector division nor square root.
+#if !defined(IMGUI_DISABLE_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMGUI_ENABLE_SSE2
+#include <emmintrin.h>  // _mm_loadu_ps, _mm_sqrt_ps, etc.
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>   // vld1q_f32, vsqrtq_f32, etc.
+#endif
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127) // condition expression is constant
@@ -357,8 +370,16 @@ ImDrawListSharedData::ImDrawListSharedData()
         const float a = ((float)i * 2 * IM_PI) / (float)IM_ARRAYSIZE(ArcFastVtx);
         ArcFastVtx[i] = ImVec2(ImCos(a), ImSin(a));
     }
+    for (int num_segments = 3; num_segments <= IM_DRAWLIST_CIRCLE_VTX_SEGMENT_MAX; num_segments++)
+        for (int i = 0; i < num_segments; i++)
+        {
+            const float a = ((float)i * 2 * IM_PI) / (float)num_segments;
+            CircleVtx[IM_DRAWLIST_CIRCLE_VTX_OFFSET(num_segments) + i] = ImVec2(ImCos(a), ImSin(a));
+        }
     memset(CircleSegmentCounts, 0, sizeof(CircleSegmentCounts)); // This will be set by SetCircleSegmentMaxError()
     TexUvLines = NULL;
+    TexUvRoundCornersFilled = TexUvRoundCornersStroked = NULL;
+    BezierCache = NULL;
 }
 
 void ImDrawListSharedData::SetCircleSegmentMaxError(float max_error)
@@ -395,6 +416,11 @@ void ImDrawList::_ResetForNewFrame()
     _TextureIdStack.resize(0);
     _Path.resize(0);
     _Splitter.Clear();
+    _TransformStack.resize(0);
+    _FringeScale = 1.0f;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    _EmitTransform = NULL;
+#endif
     CmdBuffer.push_back(ImDrawCmd());
 }
 
@@ -411,6 +437,11 @@ void ImDrawList::_ClearFreeMemory()
     _TextureIdStack.clear();
     _Path.clear();
     _Splitter.ClearFreeMemory();
+    _TransformStack.clear();
+    _FringeScale = 1.0f;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    _EmitTransform = NULL;
+#endif
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
@@ -432,6 +463,7 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, CmdBuffer, CmdBuffer.Size + 1);
     CmdBuffer.push_back(draw_cmd);
 }
 
@@ -466,6 +498,13 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
 #define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)   (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
 #define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)      (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
 
+// Commands before the first one of the current PushTransform() have their clip rectangle in another space (until PopTransform()
+// transforms the following ones), so the current command cannot be merged into them even if their settings compare equal.
+static inline bool ImDrawListCanMergeWithPrevCmd(const ImDrawList* draw_list)
+{
+    return draw_list->_TransformStack.Size == 0 || draw_list->CmdBuffer.Size - 1 > draw_list->_TransformStack.back().CmdBufferIdx;
+}
+
 // Our scheme may appears a bit unusual, basically we want the most-common calls AddLine AddRect etc. to not have to perform any check so we always have a command ready in the stack.
 // The cost of figuring out if a new command has to be added or if we can merge is paid in those Update** functions only.
 void ImDrawList::_OnChangedClipRect()
@@ -481,7 +520,7 @@ void ImDrawList::_OnChangedClipRect()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && prev_cmd->UserCallback == NULL && ImDrawListCanMergeWithPrevCmd(this))
     {
         CmdBuffer.pop_back();
         return;
@@ -503,7 +542,7 @@ void ImDrawList::_OnChangedTextureID()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && prev_cmd->UserCallback == NULL && ImDrawListCanMergeWithPrevCmd(this))
     {
         CmdBuffer.pop_back();
         return;
@@ -527,7 +566,7 @@ void ImDrawList::_OnChangedVtxOffset()
     curr_cmd->VtxOffset = _CmdHeader.VtxOffset;
 }
 
-// Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
+// Render-level scissoring. This is passed down to your render function, and used to skip fully clipped primitives when ImDrawListFlags_CullClipped is set. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
 void ImDrawList::PushClipRect(ImVec2 cr_min, ImVec2 cr_max, bool intersect_with_current_clip_rect)
 {
     ImVec4 cr(cr_min.x, cr_min.y, cr_max.x, cr_max.y);
@@ -542,6 +581,7 @@ void ImDrawList::PushClipRect(ImVec2 cr_min, ImVec2 cr_max, bool intersect_with_
     cr.z = ImMax(cr.x, cr.z);
     cr.w = ImMax(cr.y, cr.w);
 
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, _ClipRectStack, _ClipRectStack.Size + 1);
     _ClipRectStack.push_back(cr);
     _CmdHeader.ClipRect = cr;
     _OnChangedClipRect();
@@ -561,6 +601,7 @@ void ImDrawList::PopClipRect()
 
 void ImDrawList::PushTextureID(ImTextureID texture_id)
 {
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, _TextureIdStack, _TextureIdStack.Size + 1);
     _TextureIdStack.push_back(texture_id);
     _CmdHeader.TextureId = texture_id;
     _OnChangedTextureID();
@@ -573,6 +614,128 @@ void ImDrawList::PopTextureID()
     _OnChangedTextureID();
 }
 
+// Bounding box of a rectangle transformed by 't' (or by its inverse), which is the rectangle itself when not rotated
+static ImVec4 ImDrawListTransformRect(const ImDrawListTransform& t, const ImVec4& r, bool inverse)
+{
+    const ImVec2 corners[4] = { ImVec2(r.x, r.y), ImVec2(r.z, r.y), ImVec2(r.z, r.w), ImVec2(r.x, r.w) };
+    ImVec4 out(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int n = 0; n < 4; n++)
+    {
+        ImVec2 p;
+        if (inverse)
+        {
+            const float x = (corners[n].x - t.Translation.x) / t.Scale, y = (corners[n].y - t.Translation.y) / t.Scale;
+            p = ImVec2(x * t.RotationCos + y * t.RotationSin, y * t.RotationCos - x * t.RotationSin);
+        }
+        else
+        {
+            const float x = corners[n].x * t.Scale, y = corners[n].y * t.Scale;
+            p = ImVec2(t.Translation.x + x * t.RotationCos - y * t.RotationSin, t.Translation.y + x * t.RotationSin + y * t.RotationCos);
+        }
+        out.x = ImMin(out.x, p.x); out.y = ImMin(out.y, p.y);
+        out.z = ImMax(out.z, p.x); out.w = ImMax(out.w, p.y);
+    }
+    return out;
+}
+
+// Primitives are drawn in canvas coordinates: commands from CmdBufferIdx keep their clip rectangle in canvas coordinates until
+// PopTransform(), so culling and text clipping work unchanged, then their vertices and clip rectangles are transformed at once.
+void ImDrawList::PushTransform(const ImVec2& translation, float scale, float rotation)
+{
+    IM_ASSERT(scale > 0.0f);
+    ImDrawListTransform t;
+    t.Translation = translation;
+    t.Scale = scale;
+    t.RotationCos = (rotation != 0.0f) ? ImCos(rotation) : 1.0f;
+    t.RotationSin = (rotation != 0.0f) ? ImSin(rotation) : 0.0f;
+    t.BackupFringeScale = _FringeScale;
+    t.BackupClipRect = _CmdHeader.ClipRect;
+    t.VtxBufferSize = VtxBuffer.Size;
+    t.ClipRectStackSize = _ClipRectStack.Size;
+    t.ChannelsCount = _Splitter._Count;
+    t.ChannelsCurrent = _Splitter._Current;
+
+    // Start a new command, not merged with previous ones as its clip rectangle is in another space
+    if (CmdBuffer.Data[CmdBuffer.Size - 1].ElemCount != 0)
+        AddDrawCmd();
+    t.CmdBufferIdx = CmdBuffer.Size - 1;
+
+    t.ClipRect = ImDrawListTransformRect(t, t.BackupClipRect, true);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Combine with the outer transform, vertices are transformed as they are written (see IM_DRAWLIST_EMIT_POS())
+    const float m00 = t.RotationCos * scale, m01 = -t.RotationSin * scale;
+    const float m10 = t.RotationSin * scale, m11 = t.RotationCos * scale;
+    if (_EmitTransform)
+    {
+        const ImDrawListTransform& o = *_EmitTransform;
+        t.EmitTranslation = o.EmitPos(translation);
+        t.EmitM00 = o.EmitM00 * m00 + o.EmitM01 * m10; t.EmitM01 = o.EmitM00 * m01 + o.EmitM01 * m11;
+        t.EmitM10 = o.EmitM10 * m00 + o.EmitM11 * m10; t.EmitM11 = o.EmitM10 * m01 + o.EmitM11 * m11;
+    }
+    else
+    {
+        t.EmitTranslation = translation;
+        t.EmitM00 = m00; t.EmitM01 = m01;
+        t.EmitM10 = m10; t.EmitM11 = m11;
+    }
+#endif
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, _TransformStack, _TransformStack.Size + 1);
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, _ClipRectStack, _ClipRectStack.Size + 1);
+    _TransformStack.push_back(t);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    _EmitTransform = &_TransformStack.back();
+#endif
+    _ClipRectStack.push_back(t.ClipRect);
+    _CmdHeader.ClipRect = t.ClipRect;
+    CmdBuffer.Data[CmdBuffer.Size - 1].ClipRect = t.ClipRect;
+    _FringeScale = t.BackupFringeScale / scale;
+}
+
+void ImDrawList::PopTransform()
+{
+    IM_ASSERT(_TransformStack.Size > 0);
+    const ImDrawListTransform t = _TransformStack.back();
+    IM_ASSERT(_ClipRectStack.Size == t.ClipRectStackSize + 1 && "Mismatched PushClipRect()/PopClipRect() between PushTransform()/PopTransform()");
+    IM_ASSERT(_Splitter._Count == t.ChannelsCount && _Splitter._Current == t.ChannelsCurrent && "Changed channel between PushTransform()/PopTransform()");
+    _TransformStack.pop_back();
+
+    // Vertices (already transformed as they were written with IMGUI_USE_COMPACT_DRAWVERT)
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    _EmitTransform = _TransformStack.Size > 0 ? &_TransformStack.back() : NULL;
+#else
+    const float m00 = t.RotationCos * t.Scale, m01 = -t.RotationSin * t.Scale;
+    const float m10 = t.RotationSin * t.Scale, m11 = t.RotationCos * t.Scale;
+    ImDrawVert* vtx_end = VtxBuffer.Data + VtxBuffer.Size;
+    for (ImDrawVert* vtx = VtxBuffer.Data + t.VtxBufferSize; vtx < vtx_end; vtx++)
+    {
+        const ImVec2 p = vtx->pos;
+        vtx->pos = ImVec2(t.Translation.x + p.x * m00 + p.y * m01, t.Translation.y + p.x * m10 + p.y * m11);
+    }
+#endif
+
+    // Clip rectangles, also intersected with the one before PushTransform() as rotated rectangles are enclosed in bigger ones.
+    // Unchanged clip rectangles are restored exactly, so following commands can be merged with them.
+    for (int cmd_n = t.CmdBufferIdx; cmd_n < CmdBuffer.Size; cmd_n++)
+    {
+        if (memcmp(&CmdBuffer.Data[cmd_n].ClipRect, &t.ClipRect, sizeof(ImVec4)) == 0)
+        {
+            CmdBuffer.Data[cmd_n].ClipRect = t.BackupClipRect;
+            continue;
+        }
+        ImVec4 cr = ImDrawListTransformRect(t, CmdBuffer.Data[cmd_n].ClipRect, false);
+        cr.x = ImMax(cr.x, t.BackupClipRect.x);
+        cr.y = ImMax(cr.y, t.BackupClipRect.y);
+        cr.z = ImMax(ImMin(cr.z, t.BackupClipRect.z), cr.x);
+        cr.w = ImMax(ImMin(cr.w, t.BackupClipRect.w), cr.y);
+        CmdBuffer.Data[cmd_n].ClipRect = cr;
+    }
+
+    _FringeScale = t.BackupFringeScale;
+    _ClipRectStack.pop_back();
+    _CmdHeader.ClipRect = t.BackupClipRect;
+    _OnChangedClipRect();
+}
+
 // Reserve space for a number of vertices and indices.
 // You must finish filling your reserved data before calling PrimReserve() again, as it may reallocate or
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
@@ -593,10 +756,12 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, VtxBuffer, vtx_buffer_old_size + vtx_count);
     VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
 
     int idx_buffer_old_size = IdxBuffer.Size;
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, IdxBuffer, idx_buffer_old_size + idx_count);
     IdxBuffer.resize(idx_buffer_old_size + idx_count);
     _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
 }
@@ -619,10 +784,10 @@ void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+    _VtxWritePtr[0].pos = IM_DRAWLIST_EMIT_POS(this, a); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+    _VtxWritePtr[1].pos = IM_DRAWLIST_EMIT_POS(this, b); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
+    _VtxWritePtr[2].pos = IM_DRAWLIST_EMIT_POS(this, c); _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
+    _VtxWritePtr[3].pos = IM_DRAWLIST_EMIT_POS(this, d); _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -634,10 +799,10 @@ void ImDrawList::PrimRectUV(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    _VtxWritePtr[0].pos = IM_DRAWLIST_EMIT_POS(this, a); _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
+    _VtxWritePtr[1].pos = IM_DRAWLIST_EMIT_POS(this, b); _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
+    _VtxWritePtr[2].pos = IM_DRAWLIST_EMIT_POS(this, c); _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
+    _VtxWritePtr[3].pos = IM_DRAWLIST_EMIT_POS(this, d); _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -648,10 +813,10 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    _VtxWritePtr[0].pos = IM_DRAWLIST_EMIT_POS(this, a); _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
+    _VtxWritePtr[1].pos = IM_DRAWLIST_EMIT_POS(this, b); _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
+    _VtxWritePtr[2].pos = IM_DRAWLIST_EMIT_POS(this, c); _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
+    _VtxWritePtr[3].pos = IM_DRAWLIST_EMIT_POS(this, d); _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -662,32 +827,788 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     do { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = 1.0f / ImSqrt(d2); VX *= inv_len; VY *= inv_len; } } while (0)
 #define IM_FIXNORMAL2F(VX,VY)               do { float d2 = VX*VX + VY*VY; if (d2 < 0.5f) d2 = 0.5f; float inv_lensq = 1.0f / d2; VX *= inv_lensq; VY *= inv_lensq; } while (0)
 
+// 4-wide float helpers for the SIMD tessellation paths. A register holds two ImVec2 (x0, y0, x1, y1).
+// Only IEEE single-precision operations are used (no reciprocal estimates, no fused multiply-add), in the same order
+// as the scalar code, so both paths output the same vertices as long as the compiler doesn't contract the scalar code
+// into fused multiply-adds (e.g. GCC/Clang with -ffp-contract=fast when targeting FMA hardware).
+#if defined(IMGUI_ENABLE_SSE2)
+#define IMGUI_ENABLE_SIMD
+typedef __m128 ImSimdFloat4;
+static inline ImSimdFloat4  ImSimdLoad2(const ImVec2* p)                                        { return _mm_loadu_ps(&p->x); }
+static inline void          ImSimdStore2(ImVec2* p, ImSimdFloat4 v)                             { _mm_storeu_ps(&p->x, v); }
+static inline void          ImSimdStoreLo(ImVec2* p, ImSimdFloat4 v)                            { _mm_storel_pi((__m64*)(void*)p, v); }
+static inline void          ImSimdStoreHi(ImVec2* p, ImSimdFloat4 v)                            { _mm_storeh_pi((__m64*)(void*)p, v); }
+static inline ImSimdFloat4  ImSimdSet1(float f)                                                 { return _mm_set1_ps(f); }
+static inline ImSimdFloat4  ImSimdAdd(ImSimdFloat4 a, ImSimdFloat4 b)                           { return _mm_add_ps(a, b); }
+static inline ImSimdFloat4  ImSimdSub(ImSimdFloat4 a, ImSimdFloat4 b)                           { return _mm_sub_ps(a, b); }
+static inline ImSimdFloat4  ImSimdMul(ImSimdFloat4 a, ImSimdFloat4 b)                           { return _mm_mul_ps(a, b); }
+static inline ImSimdFloat4  ImSimdDiv(ImSimdFloat4 a, ImSimdFloat4 b)                           { return _mm_div_ps(a, b); }
+static inline ImSimdFloat4  ImSimdSqrt(ImSimdFloat4 a)                                          { return _mm_sqrt_ps(a); }
+static inline ImSimdFloat4  ImSimdCmpGt(ImSimdFloat4 a, ImSimdFloat4 b)                         { return _mm_cmpgt_ps(a, b); }
+static inline ImSimdFloat4  ImSimdCmpLt(ImSimdFloat4 a, ImSimdFloat4 b)                         { return _mm_cmplt_ps(a, b); }
+static inline ImSimdFloat4  ImSimdSelect(ImSimdFloat4 mask, ImSimdFloat4 a, ImSimdFloat4 b)     { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+static inline ImSimdFloat4  ImSimdSwapXY(ImSimdFloat4 a)                                        { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); }  // (y0, x0, y1, x1)
+static inline ImSimdFloat4  ImSimdNegateY(ImSimdFloat4 a)                                       { return _mm_xor_ps(a, _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f)); }
+typedef __m128i ImSimdIdx;  // 8 or 4 ImDrawIdx
+static inline ImSimdIdx     ImSimdIdxLoad(const ImDrawIdx* p)                                   { return _mm_loadu_si128((const __m128i*)(const void*)p); }
+static inline void          ImSimdIdxStore(ImDrawIdx* p, ImSimdIdx v)                           { _mm_storeu_si128((__m128i*)(void*)p, v); }
+static inline ImSimdIdx     ImSimdIdxAdd(ImSimdIdx a, ImSimdIdx b)                              { return (sizeof(ImDrawIdx) == 2) ? _mm_add_epi16(a, b) : _mm_add_epi32(a, b); }
+#elif defined(IMGUI_ENABLE_NEON)
+#define IMGUI_ENABLE_SIMD
+typedef float32x4_t ImSimdFloat4;
+static inline ImSimdFloat4  ImSimdLoad2(const ImVec2* p)                                        { return vld1q_f32(&p->x); }
+static inline void          ImSimdStore2(ImVec2* p, ImSimdFloat4 v)                             { vst1q_f32(&p->x, v); }
+static inline void          ImSimdStoreLo(ImVec2* p, ImSimdFloat4 v)                            { vst1_f32(&p->x, vget_low_f32(v)); }
+static inline void          ImSimdStoreHi(ImVec2* p, ImSimdFloat4 v)                            { vst1_f32(&p->x, vget_high_f32(v)); }
+static inline ImSimdFloat4  ImSimdSet1(float f)                                                 { return vdupq_n_f32(f); }
+static inline ImSimdFloat4  ImSimdAdd(ImSimdFloat4 a, ImSimdFloat4 b)                           { return vaddq_f32(a, b); }
+static inline ImSimdFloat4  ImSimdSub(ImSimdFloat4 a, ImSimdFloat4 b)                           { return vsubq_f32(a, b); }
+static inline ImSimdFloat4  ImSimdMul(ImSimdFloat4 a, ImSimdFloat4 b)                           { return vmulq_f32(a, b); }
+static inline ImSimdFloat4  ImSimdDiv(ImSimdFloat4 a, ImSimdFloat4 b)                           { return vdivq_f32(a, b); }
+static inline ImSimdFloat4  ImSimdSqrt(ImSimdFloat4 a)                                          { return vsqrtq_f32(a); }
+static inline ImSimdFloat4  ImSimdCmpGt(ImSimdFloat4 a, ImSimdFloat4 b)                         { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+static inline ImSimdFloat4  ImSimdCmpLt(ImSimdFloat4 a, ImSimdFloat4 b)                         { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+static inline ImSimdFloat4  ImSimdSelect(ImSimdFloat4 mask, ImSimdFloat4 a, ImSimdFloat4 b)     { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+static inline ImSimdFloat4  ImSimdSwapXY(ImSimdFloat4 a)                                        { return vrev64q_f32(a); }                                  // (y0, x0, y1, x1)
+static inline ImSimdFloat4  ImSimdNegateY(ImSimdFloat4 a)                                       { static const float sign_y[4] = { 1.0f, -1.0f, 1.0f, -1.0f }; return vmulq_f32(a, vld1q_f32(sign_y)); }
+typedef uint32x4_t ImSimdIdx;  // 8 or 4 ImDrawIdx
+static inline ImSimdIdx     ImSimdIdxLoad(const ImDrawIdx* p)                                   { return vld1q_u32((const uint32_t*)(const void*)p); }
+static inline void          ImSimdIdxStore(ImDrawIdx* p, ImSimdIdx v)                           { vst1q_u32((uint32_t*)(void*)p, v); }
+static inline ImSimdIdx     ImSimdIdxAdd(ImSimdIdx a, ImSimdIdx b)                              { return (sizeof(ImDrawIdx) == 2) ? vreinterpretq_u32_u16(vaddq_u16(vreinterpretq_u16_u32(a), vreinterpretq_u16_u32(b))) : vaddq_u32(a, b); }
+#endif
+
+#ifdef IMGUI_ENABLE_SIMD
+// (dx0 * dx0 + dy0 * dy0) in lanes 0/1 and (dx1 * dx1 + dy1 * dy1) in lanes 2/3
+static inline ImSimdFloat4  ImSimdLengthSqr2(ImSimdFloat4 v)                                    { ImSimdFloat4 sq = ImSimdMul(v, v); return ImSimdAdd(sq, ImSimdSwapXY(sq)); }
+
+// Write 'reps' repetitions of an index pattern: pattern[] is the first repetition, pattern_step[] is added to each item
+// from one repetition to the next. Indices are written eight repetitions at a time, which is a whole number of vectors.
+// The setup cost only pays off for large shapes, callers use their scalar loop below IM_SIMD_INDEX_PATTERN_MIN_REPS.
+#define IM_SIMD_INDEX_PATTERN_MAX       18  // Thick anti-aliased line segments
+#define IM_SIMD_INDEX_PATTERN_MIN_REPS  64
+static ImDrawIdx* ImSimdWriteIndexPattern(ImDrawIdx* dst, int reps, const unsigned int* pattern, const unsigned int* pattern_step, int pattern_size)
+{
+    IM_ASSERT(pattern_size <= IM_SIMD_INDEX_PATTERN_MAX);
+    const int block_size = pattern_size * 8;
+    const int block_vecs = block_size * (int)sizeof(ImDrawIdx) / 16;
+    const int vec_items = 16 / (int)sizeof(ImDrawIdx);
+    ImDrawIdx block[IM_SIMD_INDEX_PATTERN_MAX * 8];
+    ImDrawIdx block_step[IM_SIMD_INDEX_PATTERN_MAX * 8];
+    for (int r = 0; r < 8; r++)
+        for (int n = 0; n < pattern_size; n++)
+        {
+            block[r * pattern_size + n] = (ImDrawIdx)(pattern[n] + pattern_step[n] * r);
+            block_step[r * pattern_size + n] = (ImDrawIdx)(pattern_step[n] * 8);
+        }
+    ImSimdIdx v[IM_SIMD_INDEX_PATTERN_MAX * 2], v_step[IM_SIMD_INDEX_PATTERN_MAX * 2];
+    for (int k = 0; k < block_vecs; k++)
+    {
+        v[k] = ImSimdIdxLoad(&block[k * vec_items]);
+        v_step[k] = ImSimdIdxLoad(&block_step[k * vec_items]);
+    }
+    for (; reps >= 8; reps -= 8)
+    {
+        for (int k = 0; k < block_vecs; k++)
+        {
+            ImSimdIdxStore(&dst[k * vec_items], v[k]);
+            v[k] = ImSimdIdxAdd(v[k], v_step[k]);
+        }
+        dst += block_size;
+    }
+    for (int k = 0; k < block_vecs; k++)
+        ImSimdIdxStore(&block[k * vec_items], v[k]);
+    for (int n = 0; n < reps * pattern_size; n++)
+        *dst++ = block[n];
+    return dst;
+}
+
+// Normals of the line segments (p[i], p[i + 1]) for i < count, two segments at a time, same as IM_NORMALIZE2F_OVER_ZERO() + rotation.
+static void ImSimdComputeLineNormals(const ImVec2* points, const int points_count, const int count, ImVec2* out_normals)
+{
+    const ImSimdFloat4 zero = ImSimdSet1(0.0f);
+    const ImSimdFloat4 one = ImSimdSet1(1.0f);
+    int i1 = 0;
+    for (; i1 + 2 < points_count; i1 += 2)
+    {
+        ImSimdFloat4 d = ImSimdSub(ImSimdLoad2(&points[i1 + 1]), ImSimdLoad2(&points[i1]));
+        ImSimdFloat4 d2 = ImSimdLengthSqr2(d);
+        d = ImSimdSelect(ImSimdCmpGt(d2, zero), ImSimdMul(d, ImSimdDiv(one, ImSimdSqrt(d2))), d);
+        ImSimdStore2(&out_normals[i1], ImSimdNegateY(ImSimdSwapXY(d)));
+    }
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+}
+
+// Anti-aliased polyline and convex fill vertices, two points at a time. Each point outputs 'vtx_per_point' vertices placed along
+// the averaged normal at vtx_offsets[] (0.0f for the center vertex), as the scalar code does through its temporary points buffer.
+// The first point of an open line uses its segment normal as-is, other points use IM_FIXNORMAL2F() of the averaged normals.
+static ImDrawVert* ImSimdWritePolylineVertices(const ImDrawList* draw_list, ImDrawVert* vtx, const ImVec2* points, const int points_count, bool closed, const ImVec2* normals, int vtx_per_point, const float* vtx_offsets, const ImVec2* vtx_uvs, const ImU32* vtx_cols)
+{
+    IM_UNUSED(draw_list); // Only used by IM_DRAWLIST_EMIT_POS() with IMGUI_USE_COMPACT_DRAWVERT
+
+    // First point
+    {
+        float dm_x = normals[0].x;
+        float dm_y = normals[0].y;
+        if (closed)
+        {
+            dm_x = (normals[points_count - 1].x + normals[0].x) * 0.5f;
+            dm_y = (normals[points_count - 1].y + normals[0].y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+        }
+        for (int k = 0; k < vtx_per_point; k++)
+        {
+            vtx[k].pos = IM_DRAWLIST_EMIT_POS(draw_list, (vtx_offsets[k] == 0.0f) ? points[0] : ImVec2(points[0].x + dm_x * vtx_offsets[k], points[0].y + dm_y * vtx_offsets[k]));
+            vtx[k].uv = vtx_uvs[k];
+            vtx[k].col = vtx_cols[k];
+        }
+        vtx += vtx_per_point;
+    }
+
+    // Remaining points, by pairs (compact vertices are converted on write, they are handled one at a time below)
+    int i = 1;
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
+    ImSimdFloat4 offsets[4];
+    for (int k = 0; k < vtx_per_point; k++)
+        offsets[k] = ImSimdSet1(vtx_offsets[k]);
+    const ImSimdFloat4 half = ImSimdSet1(0.5f);
+    const ImSimdFloat4 one = ImSimdSet1(1.0f);
+    for (; i + 1 < points_count; i += 2)
+    {
+        ImSimdFloat4 dm = ImSimdMul(ImSimdAdd(ImSimdLoad2(&normals[i - 1]), ImSimdLoad2(&normals[i])), half);
+        ImSimdFloat4 d2 = ImSimdLengthSqr2(dm);
+        d2 = ImSimdSelect(ImSimdCmpLt(d2, half), half, d2);
+        dm = ImSimdMul(dm, ImSimdDiv(one, d2));
+        const ImSimdFloat4 p = ImSimdLoad2(&points[i]);
+        for (int k = 0; k < vtx_per_point; k++)
+        {
+            const ImSimdFloat4 pos = (vtx_offsets[k] == 0.0f) ? p : ImSimdAdd(p, ImSimdMul(dm, offsets[k]));
+            ImSimdStoreLo(&vtx[k].pos, pos);
+            ImSimdStoreHi(&vtx[vtx_per_point + k].pos, pos);
+            vtx[k].uv = vtx[vtx_per_point + k].uv = vtx_uvs[k];
+            vtx[k].col = vtx[vtx_per_point + k].col = vtx_cols[k];
+        }
+        vtx += vtx_per_point * 2;
+    }
+#endif
+    for (; i < points_count; i++)
+    {
+        float dm_x = (normals[i - 1].x + normals[i].x) * 0.5f;
+        float dm_y = (normals[i - 1].y + normals[i].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        for (int k = 0; k < vtx_per_point; k++)
+        {
+            vtx[k].pos = IM_DRAWLIST_EMIT_POS(draw_list, (vtx_offsets[k] == 0.0f) ? points[i] : ImVec2(points[i].x + dm_x * vtx_offsets[k], points[i].y + dm_y * vtx_offsets[k]));
+            vtx[k].uv = vtx_uvs[k];
+            vtx[k].col = vtx_cols[k];
+        }
+        vtx += vtx_per_point;
+    }
+    return vtx;
+}
+#endif // #ifdef IMGUI_ENABLE_SIMD
+
+// Texture coordinates for the left/right edges of a texture-based anti-aliased line (see ImFontAtlasBuildRenderLinesTexData())
+static void ImDrawListGetTexUvLines(const ImDrawListSharedData* data, int integer_thickness, float fractional_thickness, ImVec2* out_uv0, ImVec2* out_uv1)
+{
+    ImVec4 tex_uvs = data->TexUvLines[integer_thickness];
+    if (fractional_thickness != 0.0f)
+    {
+        const ImVec4 tex_uvs_1 = data->TexUvLines[integer_thickness + 1];
+        tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
+        tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
+        tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
+        tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
+    }
+    *out_uv0 = ImVec2(tex_uvs.x, tex_uvs.y);
+    *out_uv1 = ImVec2(tex_uvs.z, tex_uvs.w);
+}
+
+// Number of points of a filled circle, see AddCircleFilled()
+static int ImDrawListCalcCircleFilledSegments(const ImDrawListSharedData* data, float radius, int num_segments)
+{
+    if (num_segments > 0)
+        return num_segments;
+    const int radius_idx = ImMax((int)radius - 1, 0);
+    if (radius_idx < IM_ARRAYSIZE(data->CircleSegmentCounts))
+        return data->CircleSegmentCounts[radius_idx]; // Use cached value
+    return IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(radius, data->CircleSegmentMaxError);
+}
+
+// Texture coordinates of a baked anti-aliased filled corner (see ImFontAtlasBuildRenderRoundCornersTexData()), outer corner in xy and circle center in zw.
+// Corners are baked for integer radii and scaled to the requested radius, which is indistinguishable for the small radii we bake.
+static bool ImDrawListGetTexUvRoundCornerFilled(const ImDrawList* draw_list, float radius, ImVec4* out_uvs)
+{
+    if ((draw_list->Flags & (ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AntiAliasedRoundCornersUseTex)) != (ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AntiAliasedRoundCornersUseTex) || draw_list->_FringeScale != 1.0f)
+        return false;
+    const int radius_idx = (int)(radius + 0.5f);
+    if (radius_idx < 1 || radius_idx > IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX)
+        return false;
+    IM_ASSERT_PARANOID(!(draw_list->_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners)); // NewFrame() doesn't set ImDrawListFlags_AntiAliasedRoundCornersUseTex in this case
+    *out_uvs = draw_list->_Data->TexUvRoundCornersFilled[radius_idx];
+    return true;
+}
+
+// Texture coordinates of a baked anti-aliased 1 pixel wide stroked corner, outer corner in xy and inner corner of the 'out_size' pixels square in zw.
+// Scaling would also scale the stroke thickness, so they are only used for 1.0f thick strokes with an outer radius multiple of 0.5f.
+static bool ImDrawListGetTexUvRoundCornerStroked(const ImDrawList* draw_list, float radius_outer, float thickness, ImVec4* out_uvs, float* out_size)
+{
+    if ((draw_list->Flags & (ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedRoundCornersUseTex)) != (ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedRoundCornersUseTex) || thickness != 1.0f || draw_list->_FringeScale != 1.0f)
+        return false;
+    const float radius_x2 = radius_outer * 2.0f;
+    const int radius_x2_idx = (int)(radius_x2 + 0.5f);
+    if (radius_x2_idx < 2 || radius_x2_idx > IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2 + 1 || ImFabs(radius_x2 - (float)radius_x2_idx) > 0.01f)
+        return false;
+    IM_ASSERT_PARANOID(!(draw_list->_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners)); // NewFrame() doesn't set ImDrawListFlags_AntiAliasedRoundCornersUseTex in this case
+    *out_uvs = draw_list->_Data->TexUvRoundCornersStroked[radius_x2_idx];
+    *out_size = (float)((radius_x2_idx + 1) / 2);
+    return true;
+}
+
+// Write a circle as a 3x3 grid of vertices, each quarter mapping a baked corner mirrored around the center. Require 24 indices and 9 vertices to be reserved.
+static void ImDrawListPrimCircleTex(ImDrawList* draw_list, const ImVec2& center, float half_size, const ImVec2& uv_outer, const ImVec2& uv_center, ImU32 col)
+{
+    const float pos_x[3] = { center.x - half_size, center.x, center.x + half_size };
+    const float pos_y[3] = { center.y - half_size, center.y, center.y + half_size };
+    const float uv_x[3] = { uv_outer.x, uv_center.x, uv_outer.x };
+    const float uv_y[3] = { uv_outer.y, uv_center.y, uv_outer.y };
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    for (int y = 0; y < 3; y++)
+        for (int x = 0; x < 3; x++, vtx_write++)
+        {
+            vtx_write->pos = IM_DRAWLIST_EMIT_POS(draw_list, ImVec2(pos_x[x], pos_y[y]));
+            vtx_write->uv = ImVec2(uv_x[x], uv_y[y]);
+            vtx_write->col = col;
+        }
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    for (int quarter = 0; quarter < 4; quarter++, idx_write += 6)
+    {
+        const unsigned int idx = draw_list->_VtxCurrentIdx + (quarter >> 1) * 3 + (quarter & 1);
+        idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 4);
+        idx_write[3] = (ImDrawIdx)(idx); idx_write[4] = (ImDrawIdx)(idx + 4); idx_write[5] = (ImDrawIdx)(idx + 3);
+    }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx += 9;
+}
+
+// Indices of one anti-aliased line segment, relative to the first vertex of the segment, for texture-based (2 vertices per point), thin (3) and thick (4) lines
+static const unsigned int ImDrawListLineIndicesTex[6] = { 2, 0, 1, 3, 1, 2 };
+static const unsigned int ImDrawListLineIndicesThin[12] = { 3, 0, 2, 2, 5, 3, 4, 1, 0, 0, 3, 4 };
+static const unsigned int ImDrawListLineIndicesThick[18] = { 5, 1, 2, 2, 6, 5, 5, 1, 0, 0, 4, 5, 6, 2, 3, 3, 7, 6 };
+
+// Coarse CPU culling (ImDrawListFlags_CullClipped): return true when the bounding box of 'points' expanded by 'pad' is entirely outside
+// of the current clip rectangle, so the primitive would be fully scissored by the renderer. An extra pixel covers back-ends rounding clip
+// rectangles to integer scissor rectangles. Strokes use ImDrawListCalcStrokePad(), filled shapes a 1.0f pad for their anti-aliased fringe.
+static bool ImDrawListIsClipped(const ImDrawList* draw_list, const ImVec2* points, int points_count, float pad)
+{
+    if (!(draw_list->Flags & ImDrawListFlags_CullClipped))
+        return false;
+    float min_x = points[0].x, min_y = points[0].y, max_x = min_x, max_y = min_y;
+    for (int i = 1; i < points_count; i++)
+    {
+        min_x = ImMin(min_x, points[i].x); max_x = ImMax(max_x, points[i].x);
+        min_y = ImMin(min_y, points[i].y); max_y = ImMax(max_y, points[i].y);
+    }
+    pad = (pad + 1.0f) * ImMax(draw_list->_FringeScale, 1.0f); // Pixels are bigger than units when zoomed out with PushTransform()
+    const ImVec4& clip_rect = draw_list->_CmdHeader.ClipRect;
+    return max_x + pad < clip_rect.x || min_x - pad > clip_rect.z || max_y + pad < clip_rect.y || min_y - pad > clip_rect.w;
+}
+
+static inline bool ImDrawListIsRectClipped(const ImDrawList* draw_list, const ImVec2& a, const ImVec2& b, float pad)
+{
+    const ImVec2 points[2] = { a, b };
+    return ImDrawListIsClipped(draw_list, points, 2, pad);
+}
+
+// Same test as AddLine() through AddPolyline()
+static inline bool ImDrawListIsLineClipped(const ImDrawList* draw_list, const ImVec2& p1, const ImVec2& p2, float pad)
+{
+    const ImVec2 points[2] = { ImVec2(p1.x + 0.5f, p1.y + 0.5f), ImVec2(p2.x + 0.5f, p2.y + 0.5f) };
+    return ImDrawListIsClipped(draw_list, points, 2, pad);
+}
+
+// Same test as AddCircleFilled()
+static inline bool ImDrawListIsCircleClipped(const ImDrawList* draw_list, const ImVec2& center, float radius)
+{
+    return ImDrawListIsRectClipped(draw_list, ImVec2(center.x - radius, center.y - radius), ImVec2(center.x + radius, center.y + radius), 1.0f);
+}
+
+// Stroke vertices are offset from their points by at most sqrt(2) * (half thickness + AA_SIZE) (see IM_FIXNORMAL2F), plus the 0.5f offset of AddLine()/AddRect()
+static inline float ImDrawListCalcStrokePad(float thickness)
+{
+    return ImMax(thickness, 1.0f) * 0.75f + 2.0f;
+}
+
+// Thick lines with joins and caps, used by AddPolyline() when any ImDrawLineFlags_JoinXXX/ImDrawLineFlags_CapXXX flag is set.
+// - The stroke is a strip of cross sections connected by quads. With anti-aliasing a section has 4 vertices from left to right:
+//   transparent fringe, core, core, transparent fringe (3 quads between sections), without anti-aliasing only the 2 core vertices.
+// - Joins share a single section on the inner side where the edges of both segments cross, and add vertices on the outer side only: none
+//   for a miter (the section is moved to the miter point), 2 per step for bevel (1 step) and round joins (steps of a circle of the same
+//   thickness). At sharp turns between short segments the inner side pivots around the point instead, see ImDrawListStrokeCalcJoin().
+// - Butt and square caps add a section of transparent vertices for the AA fringe, round caps sections along a quarter circle each side.
+struct ImDrawListStroke
+{
+    const ImDrawList* DrawList;
+    ImDrawVert*     VtxWritePtr;        // Copies of ImDrawList::_VtxWritePtr, _IdxWritePtr, _VtxCurrentIdx, written back at the end
+    ImDrawIdx*      IdxWritePtr;
+    unsigned int    VtxCurrentIdx;
+    ImVec2          TexUvWhitePixel;
+    ImU32           Col;
+    ImU32           ColTrans;
+    bool            AntiAliased;
+    int             Columns;            // Vertices per section: 4 with anti-aliasing, 2 without
+    float           HalfCore;           // Distance from the center of the line to its core vertices
+    float           HalfFringe;         // Distance from the center of the line to its fringe vertices (== HalfCore without anti-aliasing)
+    float           HalfThickness;
+    int             CircleSegments;     // Tessellation of round joins and caps
+};
+
+static inline unsigned int ImDrawListStrokeVtx(ImDrawListStroke& s, float x, float y, ImU32 col)
+{
+    s.VtxWritePtr->pos = IM_DRAWLIST_EMIT_POS(s.DrawList, ImVec2(x, y)); s.VtxWritePtr->uv = s.TexUvWhitePixel; s.VtxWritePtr->col = col;
+    s.VtxWritePtr++;
+    return s.VtxCurrentIdx++;
+}
+
+// Write a section centered on 'p' along the unit vector 'n' (pointing to the left side), at the given distances from 'p'
+static inline void ImDrawListStrokeSection(ImDrawListStroke& s, const ImVec2& p, const ImVec2& n, float d_core, float d_fringe, ImU32 col_core, unsigned int* section)
+{
+    if (s.AntiAliased)
+    {
+        section[0] = ImDrawListStrokeVtx(s, p.x + n.x * d_fringe, p.y + n.y * d_fringe, s.ColTrans);
+        section[1] = ImDrawListStrokeVtx(s, p.x + n.x * d_core, p.y + n.y * d_core, col_core);
+        section[2] = ImDrawListStrokeVtx(s, p.x - n.x * d_core, p.y - n.y * d_core, col_core);
+        section[3] = ImDrawListStrokeVtx(s, p.x - n.x * d_fringe, p.y - n.y * d_fringe, s.ColTrans);
+    }
+    else
+    {
+        section[0] = ImDrawListStrokeVtx(s, p.x + n.x * d_core, p.y + n.y * d_core, col_core);
+        section[1] = ImDrawListStrokeVtx(s, p.x - n.x * d_core, p.y - n.y * d_core, col_core);
+    }
+}
+
+// Connect two sections with one quad per pair of columns
+static inline void ImDrawListStrokeConnect(ImDrawListStroke& s, const unsigned int* a, const unsigned int* b)
+{
+    ImDrawIdx* idx = s.IdxWritePtr;
+    idx[0] = (ImDrawIdx)a[0]; idx[1] = (ImDrawIdx)a[1]; idx[2] = (ImDrawIdx)b[1];
+    idx[3] = (ImDrawIdx)a[0]; idx[4] = (ImDrawIdx)b[1]; idx[5] = (ImDrawIdx)b[0];
+    if (s.AntiAliased)
+    {
+        idx[6]  = (ImDrawIdx)a[1]; idx[7]  = (ImDrawIdx)a[2]; idx[8]  = (ImDrawIdx)b[2];
+        idx[9]  = (ImDrawIdx)a[1]; idx[10] = (ImDrawIdx)b[2]; idx[11] = (ImDrawIdx)b[1];
+        idx[12] = (ImDrawIdx)a[2]; idx[13] = (ImDrawIdx)a[3]; idx[14] = (ImDrawIdx)b[3];
+        idx[15] = (ImDrawIdx)a[2]; idx[16] = (ImDrawIdx)b[3]; idx[17] = (ImDrawIdx)b[2];
+        idx += 12;
+    }
+    s.IdxWritePtr = idx + 6;
+}
+
+// Order vertices of a join section from left to right, given the outer side of the turn
+static inline void ImDrawListStrokeSetSection(const ImDrawListStroke& s, float side, unsigned int outer_core, unsigned int outer_fringe, unsigned int inner_core, unsigned int inner_fringe, unsigned int* section)
+{
+    if (s.AntiAliased && side > 0.0f)   { section[0] = outer_fringe; section[1] = outer_core; section[2] = inner_core; section[3] = inner_fringe; }
+    else if (s.AntiAliased)             { section[0] = inner_fringe; section[1] = inner_core; section[2] = outer_core; section[3] = outer_fringe; }
+    else if (side > 0.0f)               { section[0] = outer_core; section[1] = inner_core; }
+    else                                { section[0] = inner_core; section[1] = outer_core; }
+}
+
+// Number of outer steps of a join between the incoming segment (unit direction 'd0', length 'len0') and the outgoing one ('d1', 'len1'):
+// 0 for a miter or a straight joint, 1 for a bevel, more for round joins. Sets 'pivot' when the inner side pivots around the point.
+static int ImDrawListStrokeCalcJoin(const ImDrawListStroke& s, const ImVec2& d0, float len0, const ImVec2& d1, float len1, ImDrawLineFlags flags, bool* pivot)
+{
+    const float cos_turn = ImClamp(d0.x * d1.x + d0.y * d1.y, -1.0f, 1.0f);
+    *pivot = false;
+    if (cos_turn >= 0.99999f)
+        return 0;
+
+    // Inner edges of both segments cross at HalfFringe * tan(turn / 2) from the point along each segment. Use that crossing as long as it is
+    // within the first half of both segments, so the inner vertices of consecutive joins can't cross each other.
+    const float cos_half = ImSqrt((1.0f + cos_turn) * 0.5f);
+    const float sin_half = ImSqrt((1.0f - cos_turn) * 0.5f);
+    *pivot = s.HalfFringe * sin_half > ImMin(len0, len1) * 0.5f * cos_half;
+    if (flags & ImDrawLineFlags_JoinRound)
+        return ImMax((int)ImCeil(s.CircleSegments * ImAcos(cos_turn) / (IM_PI * 2.0f)), 1);
+    if (flags & ImDrawLineFlags_JoinBevel)
+        return 1;
+    // Miter length / thickness == 1 / cos(turn / 2). When pivoting, the miter point is the middle step between both segment edges.
+    if (cos_half * IM_DRAWLIST_MITER_LIMIT < 1.0f)
+        return 1;
+    return *pivot ? 2 : 0;
+}
+
+// Number of quarter circle steps of round caps
+static inline int ImDrawListStrokeCalcCapSteps(const ImDrawListStroke& s)
+{
+    return ImMax((s.CircleSegments + 3) / 4, 1);
+}
+
+// Write a miter join or a straight joint without pivot (steps == 0): a single section along the bisector of the normals
+static inline void ImDrawListStrokeJoinMiter(ImDrawListStroke& s, const ImVec2& p, const ImVec2& d0, const ImVec2& d1, unsigned int* section)
+{
+    ImVec2 m(d0.y + d1.y, -d0.x - d1.x);
+    const float m_scale = 2.0f / ImMax(m.x * m.x + m.y * m.y, 0.0001f); // == 1 / (|m| * cos_half), with |m| == 2 * cos_half
+    m.x *= m_scale;
+    m.y *= m_scale;
+    if (s.AntiAliased)
+    {
+        section[0] = ImDrawListStrokeVtx(s, p.x + m.x * s.HalfFringe, p.y + m.y * s.HalfFringe, s.ColTrans);
+        section[1] = ImDrawListStrokeVtx(s, p.x + m.x * s.HalfCore, p.y + m.y * s.HalfCore, s.Col);
+        section[2] = ImDrawListStrokeVtx(s, p.x - m.x * s.HalfCore, p.y - m.y * s.HalfCore, s.Col);
+        section[3] = ImDrawListStrokeVtx(s, p.x - m.x * s.HalfFringe, p.y - m.y * s.HalfFringe, s.ColTrans);
+    }
+    else
+    {
+        section[0] = ImDrawListStrokeVtx(s, p.x + m.x * s.HalfCore, p.y + m.y * s.HalfCore, s.Col);
+        section[1] = ImDrawListStrokeVtx(s, p.x - m.x * s.HalfCore, p.y - m.y * s.HalfCore, s.Col);
+    }
+}
+
+// Write a join at 'p' between the incoming segment (unit direction 'd0') and the outgoing one ('d1') with 1 or more steps, or when pivoting.
+// 'arriving' receives the section ending the incoming segment, 'leaving' the one starting the outgoing segment.
+// - Outer side: pairs of core/fringe vertices from the edge of the incoming segment to the edge of the outgoing one, or at the miter point.
+// - Inner side: a single pair where the inner edges cross, which the outer vertices are fanned around. When pivoting, the inner edges end
+//   at the point instead (the segments overlap on the inner side) and the outer vertices are fanned around the point.
+static void ImDrawListStrokeJoin(ImDrawListStroke& s, const ImVec2& p, const ImVec2& d0, const ImVec2& d1, int steps, bool pivot, bool round, unsigned int* arriving, unsigned int* leaving)
+{
+    const ImVec2 n0(d0.y, -d0.x);
+    const ImVec2 n1(d1.y, -d1.x);
+
+    // Outer side of the turn (+1.0f: left side along +n, -1.0f: right side along -n), and bisector 'm' of the normals (pointing to the left side)
+    const float side = (d0.x * d1.y - d0.y * d1.x) >= 0.0f ? 1.0f : -1.0f;
+    ImVec2 m(n0.x + n1.x, n0.y + n1.y);
+    const float cos_half = ImMax(ImSqrt(m.x * m.x + m.y * m.y) * 0.5f, 0.0001f);
+    m.x *= 0.5f / cos_half;
+    m.y *= 0.5f / cos_half;
+
+    // Inner vertices
+    unsigned int inner_core_0, inner_fringe_0, inner_core_1, inner_fringe_1, fan_center;
+    if (!pivot)
+    {
+        const float d_core = -side * s.HalfCore / cos_half;
+        const float d_fringe = -side * s.HalfFringe / cos_half;
+        inner_core_0 = inner_core_1 = fan_center = ImDrawListStrokeVtx(s, p.x + m.x * d_core, p.y + m.y * d_core, s.Col);
+        inner_fringe_0 = inner_fringe_1 = s.AntiAliased ? ImDrawListStrokeVtx(s, p.x + m.x * d_fringe, p.y + m.y * d_fringe, s.ColTrans) : inner_core_0;
+    }
+    else
+    {
+        const float d_core = -side * s.HalfCore;
+        const float d_fringe = -side * s.HalfFringe;
+        fan_center = ImDrawListStrokeVtx(s, p.x, p.y, s.Col);
+        inner_core_0 = ImDrawListStrokeVtx(s, p.x + n0.x * d_core, p.y + n0.y * d_core, s.Col);
+        inner_core_1 = ImDrawListStrokeVtx(s, p.x + n1.x * d_core, p.y + n1.y * d_core, s.Col);
+        inner_fringe_0 = s.AntiAliased ? ImDrawListStrokeVtx(s, p.x + n0.x * d_fringe, p.y + n0.y * d_fringe, s.ColTrans) : inner_core_0;
+        inner_fringe_1 = s.AntiAliased ? ImDrawListStrokeVtx(s, p.x + n1.x * d_fringe, p.y + n1.y * d_fringe, s.ColTrans) : inner_core_1;
+    }
+
+    // Outer vertices
+    unsigned int outer_core_prev = 0, outer_fringe_prev = 0;
+    float arc_cos = 1.0f, arc_sin = 0.0f, step_cos = 1.0f, step_sin = 0.0f;
+    if (round && steps > 1)
+    {
+        const float step_angle = ImAcos(ImClamp(d0.x * d1.x + d0.y * d1.y, -1.0f, 1.0f)) / steps;
+        step_cos = ImCos(step_angle);
+        step_sin = ImSin(step_angle);
+    }
+    for (int step = 0; step <= steps; step++)
+    {
+        ImVec2 dir;
+        float d_core = s.HalfCore, d_fringe = s.HalfFringe;
+        if (step == steps)
+        {
+            dir = ImVec2(n1.x * side, n1.y * side);
+        }
+        else if (step > 0 && !round)
+        {
+            // Miter point
+            dir = ImVec2(m.x * side, m.y * side);
+            d_core /= cos_half;
+            d_fringe /= cos_half;
+        }
+        else
+        {
+            // Rotate from side * n0 toward d0 (== side * n1 when the turn is complete)
+            dir = ImVec2(n0.x * side * arc_cos + d0.x * arc_sin, n0.y * side * arc_cos + d0.y * arc_sin);
+            const float next_cos = arc_cos * step_cos - arc_sin * step_sin;
+            arc_sin = arc_sin * step_cos + arc_cos * step_sin;
+            arc_cos = next_cos;
+        }
+        const unsigned int outer_core = ImDrawListStrokeVtx(s, p.x + dir.x * d_core, p.y + dir.y * d_core, s.Col);
+        const unsigned int outer_fringe = s.AntiAliased ? ImDrawListStrokeVtx(s, p.x + dir.x * d_fringe, p.y + dir.y * d_fringe, s.ColTrans) : outer_core;
+
+        // Fan: core triangle, and fringe quad on the outside
+        if (step > 0)
+        {
+            ImDrawIdx* idx = s.IdxWritePtr;
+            idx[0] = (ImDrawIdx)fan_center; idx[1] = (ImDrawIdx)outer_core_prev; idx[2] = (ImDrawIdx)outer_core;
+            if (s.AntiAliased)
+            {
+                idx[3] = (ImDrawIdx)outer_core_prev; idx[4] = (ImDrawIdx)outer_fringe_prev; idx[5] = (ImDrawIdx)outer_fringe;
+                idx[6] = (ImDrawIdx)outer_core_prev; idx[7] = (ImDrawIdx)outer_fringe; idx[8] = (ImDrawIdx)outer_core;
+                idx += 6;
+            }
+            s.IdxWritePtr = idx + 3;
+        }
+
+        if (step == 0)
+            ImDrawListStrokeSetSection(s, side, outer_core, outer_fringe, inner_core_0, inner_fringe_0, arriving);
+        if (step == steps)
+            ImDrawListStrokeSetSection(s, side, outer_core, outer_fringe, inner_core_1, inner_fringe_1, leaving);
+        outer_core_prev = outer_core;
+        outer_fringe_prev = outer_fringe;
+    }
+}
+
+// Write a cap at 'p' extending along the unit direction 'd' (pointing outside of the line, e.g. toward the previous point for the first
+// point), 'n' being the left normal of the line. 'base' receives the section connected to the line.
+static void ImDrawListStrokeCap(ImDrawListStroke& s, const ImVec2& p, const ImVec2& d, const ImVec2& n, ImDrawLineFlags flags, unsigned int* base)
+{
+    if (flags & ImDrawLineFlags_CapRound)
+    {
+        // Sections along a quarter circle, from the tip (where both sides meet) to the base
+        const int steps = ImDrawListStrokeCalcCapSteps(s);
+        unsigned int section_prev[4];
+        const unsigned int tip_core = ImDrawListStrokeVtx(s, p.x + d.x * s.HalfCore, p.y + d.y * s.HalfCore, s.Col);
+        if (s.AntiAliased)
+        {
+            const unsigned int tip_fringe = ImDrawListStrokeVtx(s, p.x + d.x * s.HalfFringe, p.y + d.y * s.HalfFringe, s.ColTrans);
+            section_prev[0] = section_prev[3] = tip_fringe;
+            section_prev[1] = section_prev[2] = tip_core;
+        }
+        else
+        {
+            section_prev[0] = section_prev[1] = tip_core;
+        }
+        for (int step = 1; step <= steps; step++)
+        {
+            const float a = (IM_PI * 0.5f) * step / steps;
+            const float a_cos = (step == steps) ? 0.0f : ImCos(a);
+            const float a_sin = (step == steps) ? 1.0f : ImSin(a);
+            const ImVec2 c(p.x + d.x * s.HalfCore * a_cos, p.y + d.y * s.HalfCore * a_cos);
+            ImDrawListStrokeSection(s, c, n, s.HalfCore * a_sin, s.HalfFringe * a_sin, s.Col, base);
+            if (s.AntiAliased)
+            {
+                // Fringe vertices are pushed outward radially rather than sideways (from the core vertices, computed again rather than
+                // read back as they may have been transformed by IM_DRAWLIST_EMIT_POS())
+                ImDrawVert* vtx = s.VtxWritePtr - 4;
+                const float fringe = s.HalfFringe - s.HalfCore;
+                const ImVec2 p1(c.x + n.x * s.HalfCore * a_sin, c.y + n.y * s.HalfCore * a_sin);
+                const ImVec2 p2(c.x - n.x * s.HalfCore * a_sin, c.y - n.y * s.HalfCore * a_sin);
+                vtx[0].pos = IM_DRAWLIST_EMIT_POS(s.DrawList, ImVec2(p1.x + (d.x * a_cos + n.x * a_sin) * fringe, p1.y + (d.y * a_cos + n.y * a_sin) * fringe));
+                vtx[3].pos = IM_DRAWLIST_EMIT_POS(s.DrawList, ImVec2(p2.x + (d.x * a_cos - n.x * a_sin) * fringe, p2.y + (d.y * a_cos - n.y * a_sin) * fringe));
+            }
+            ImDrawListStrokeConnect(s, section_prev, base);
+            for (int c = 0; c < s.Columns; c++)
+                section_prev[c] = base[c];
+        }
+        return;
+    }
+
+    // Butt and square caps: the line core ends half an AA fringe before the end, a transparent section half an AA fringe past it
+    const float extend = (flags & ImDrawLineFlags_CapSquare) ? s.HalfThickness : 0.0f;
+    if (!s.AntiAliased)
+    {
+        ImDrawListStrokeSection(s, ImVec2(p.x + d.x * extend, p.y + d.y * extend), n, s.HalfCore, s.HalfFringe, s.Col, base);
+        return;
+    }
+    const float AA_SIZE = s.HalfFringe - s.HalfCore;
+    unsigned int section_end[4];
+    ImDrawListStrokeSection(s, ImVec2(p.x + d.x * (extend + AA_SIZE * 0.5f), p.y + d.y * (extend + AA_SIZE * 0.5f)), n, s.HalfCore, s.HalfFringe, s.ColTrans, section_end);
+    ImDrawListStrokeSection(s, ImVec2(p.x + d.x * (extend - AA_SIZE * 0.5f), p.y + d.y * (extend - AA_SIZE * 0.5f)), n, s.HalfCore, s.HalfFringe, s.Col, base);
+    ImDrawListStrokeConnect(s, section_end, base);
+}
+
+static void ImDrawListAddPolylineStroke(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness, ImDrawLineFlags flags)
+{
+    ImDrawListStroke s;
+    s.Col = col;
+    s.ColTrans = col & ~IM_COL32_A_MASK;
+    s.AntiAliased = (draw_list->Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    s.Columns = s.AntiAliased ? 4 : 2;
+    if (s.AntiAliased)
+    {
+        // Thicknesses <1.0 should behave like thickness 1.0 (one pixel, see _FringeScale)
+        const float AA_SIZE = draw_list->_FringeScale;
+        thickness = ImMax(thickness, AA_SIZE);
+        s.HalfCore = (thickness - AA_SIZE) * 0.5f;
+        s.HalfFringe = s.HalfCore + AA_SIZE;
+    }
+    else
+    {
+        if (thickness <= 0.0f)
+            return;
+        s.HalfCore = s.HalfFringe = thickness * 0.5f;
+    }
+    s.HalfThickness = thickness * 0.5f;
+    s.CircleSegments = ((flags & (ImDrawLineFlags_JoinRound | ImDrawLineFlags_CapRound)) != 0) ? ImDrawListCalcCircleFilledSegments(draw_list->_Data, s.HalfFringe / draw_list->_FringeScale, 0) : 0;
+
+    // Temporary buffer: points without consecutive duplicates, then direction and length of each segment, then join steps of each point (<< 1, | 1 when pivoting)
+    ImVec2* temp_points = (ImVec2*)alloca(points_count * (sizeof(ImVec2) * 2 + sizeof(float) + sizeof(int))); //-V630
+    ImVec2* temp_dirs = temp_points + points_count;
+    float* temp_lengths = (float*)(void*)(temp_dirs + points_count);
+    int* temp_steps = (int*)(void*)(temp_lengths + points_count);
+    int count = 0;
+    for (int i = 0; i < points_count; i++)
+        if (count == 0 || ImLengthSqr(points[i] - temp_points[count - 1]) > 1e-6f)
+            temp_points[count++] = points[i];
+    if (closed && count > 2 && ImLengthSqr(temp_points[count - 1] - temp_points[0]) <= 1e-6f)
+        count--;
+    if (count < 2)
+        return;
+    if (count == 2)
+        closed = false;
+    const int segments_count = closed ? count : count - 1;
+    for (int i1 = 0; i1 < segments_count; i1++)
+    {
+        const int i2 = (i1 + 1) == count ? 0 : i1 + 1;
+        const ImVec2 d = temp_points[i2] - temp_points[i1];
+        temp_lengths[i1] = ImSqrt(ImLengthSqr(d));
+        temp_dirs[i1] = d / temp_lengths[i1];
+    }
+
+    // Count vertices and indices
+    const int section_idx = (s.Columns - 1) * 6;
+    const int fan_idx = s.AntiAliased ? 9 : 3;
+    int vtx_count = 0;
+    int idx_count = segments_count * section_idx;
+    for (int i = 0; i < count; i++)
+    {
+        if (!closed && (i == 0 || i == count - 1))
+        {
+            const int steps = (flags & ImDrawLineFlags_CapRound) ? ImDrawListStrokeCalcCapSteps(s) : (s.AntiAliased ? 1 : 0);
+            vtx_count += (flags & ImDrawLineFlags_CapRound) ? (s.Columns / 2 + steps * s.Columns) : (steps + 1) * s.Columns;
+            idx_count += steps * section_idx;
+            continue;
+        }
+        const int i0 = (i == 0) ? segments_count - 1 : i - 1;
+        bool pivot;
+        const int steps = ImDrawListStrokeCalcJoin(s, temp_dirs[i0], temp_lengths[i0], temp_dirs[i], temp_lengths[i], flags, &pivot);
+        temp_steps[i] = (steps << 1) | (pivot ? 1 : 0);
+        vtx_count += pivot ? (1 + (steps + 3) * (s.Columns / 2)) : (steps + 2) * (s.Columns / 2);
+        idx_count += steps * fan_idx;
+    }
+    draw_list->PrimReserve(idx_count, vtx_count);
+    s.DrawList = draw_list;
+    s.VtxWritePtr = draw_list->_VtxWritePtr;
+    s.IdxWritePtr = draw_list->_IdxWritePtr;
+    s.VtxCurrentIdx = draw_list->_VtxCurrentIdx;
+    s.TexUvWhitePixel = draw_list->_Data->TexUvWhitePixel;
+
+    // Write sections for each point and connect them along segments
+    unsigned int first_arriving[4], arriving[4], leaving[4], leaving_prev[4];
+    for (int i = 0; i < count; i++)
+    {
+        if (!closed && i == 0)
+            ImDrawListStrokeCap(s, temp_points[i], ImVec2(-temp_dirs[0].x, -temp_dirs[0].y), ImVec2(temp_dirs[0].y, -temp_dirs[0].x), flags, leaving);
+        else if (!closed && i == count - 1)
+            ImDrawListStrokeCap(s, temp_points[i], temp_dirs[i - 1], ImVec2(temp_dirs[i - 1].y, -temp_dirs[i - 1].x), flags, arriving);
+        else if (temp_steps[i] == 0)
+        {
+            ImDrawListStrokeJoinMiter(s, temp_points[i], temp_dirs[(i == 0) ? segments_count - 1 : i - 1], temp_dirs[i], arriving);
+            memcpy(leaving, arriving, sizeof(arriving));
+        }
+        else
+        {
+            const int i0 = (i == 0) ? segments_count - 1 : i - 1;
+            ImDrawListStrokeJoin(s, temp_points[i], temp_dirs[i0], temp_dirs[i], temp_steps[i] >> 1, (temp_steps[i] & 1) != 0, (flags & ImDrawLineFlags_JoinRound) != 0, arriving, leaving);
+        }
+        if (i > 0)
+            ImDrawListStrokeConnect(s, leaving_prev, arriving);
+        else if (closed)
+            memcpy(first_arriving, arriving, sizeof(arriving));
+        memcpy(leaving_prev, leaving, sizeof(leaving));
+    }
+    if (closed)
+        ImDrawListStrokeConnect(s, leaving_prev, first_arriving);
+    IM_ASSERT(s.VtxWritePtr == draw_list->_VtxWritePtr + vtx_count && s.IdxWritePtr == draw_list->_IdxWritePtr + idx_count);
+    draw_list->_VtxWritePtr = s.VtxWritePtr;
+    draw_list->_IdxWritePtr = s.IdxWritePtr;
+    draw_list->_VtxCurrentIdx = s.VtxCurrentIdx;
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
-void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
+void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness, ImDrawLineFlags flags)
 {
     if (points_count < 2)
         return;
 
+    // Joins and caps: miters may extend up to IM_DRAWLIST_MITER_LIMIT * thickness / 2 away from their point
+    const bool use_stroke = (flags & (ImDrawLineFlags_JoinMask_ | ImDrawLineFlags_CapMask_)) != 0;
+    if (Flags & ImDrawListFlags_CullClipped)
+    {
+        const float pad = use_stroke ? (ImMax(thickness, 1.0f) * 0.5f + 1.0f) * ImMax(IM_DRAWLIST_MITER_LIMIT, 1.5f) + 1.0f : ImDrawListCalcStrokePad(thickness);
+        if (ImDrawListIsClipped(this, points, points_count, pad))
+            return;
+
+        // Long open polylines crossing the clip rectangle only output runs of segments which are visible or next to a visible one.
+        // Joints of visible segments are unchanged, and the extra segments at both ends of a run are fully clipped either way.
+        const int CULL_SEGMENTS_MIN = 64;
+        if (!closed && points_count > CULL_SEGMENTS_MIN)
+        {
+            const int segments_count = points_count - 1;
+            bool visible_prev = false;
+            bool visible_curr = !ImDrawListIsRectClipped(this, points[0], points[1], pad);
+            int run_start = -1;
+            bool all_kept = false;
+            for (int i = 0; i < segments_count; i++)
+            {
+                const bool visible_next = (i + 1 < segments_count) && !ImDrawListIsRectClipped(this, points[i + 1], points[i + 2], pad);
+                const bool keep = visible_prev || visible_curr || visible_next;
+                if (keep && run_start < 0)
+                    run_start = i;
+                if (run_start >= 0 && (!keep || i + 1 == segments_count))
+                {
+                    const int run_end = keep ? i + 1 : i;
+                    all_kept = (run_start == 0 && run_end == segments_count);
+                    if (all_kept)
+                        break;
+                    Flags &= ~ImDrawListFlags_CullClipped;
+                    AddPolyline(points + run_start, run_end - run_start + 1, col, false, thickness, flags);
+                    Flags |= ImDrawListFlags_CullClipped;
+                    run_start = -1;
+                }
+                visible_prev = visible_curr;
+                visible_curr = visible_next;
+            }
+            if (!all_kept)
+                return;
+        }
+    }
+
+    if (use_stroke)
+    {
+        ImDrawListAddPolylineStroke(this, points, points_count, col, closed, thickness, flags);
+        return;
+    }
+
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
     const int count = closed ? points_count : points_count - 1; // The number of line segments we need to draw
-    const bool thick_line = (thickness > 1.0f);
+    const bool thick_line = (thickness > _FringeScale);
 
     if (Flags & ImDrawListFlags_AntiAliasedLines)
     {
         // Anti-aliased stroke
-        const float AA_SIZE = 1.0f;
+        const float AA_SIZE = _FringeScale;
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
 
-        // Thicknesses <1.0 should behave like thickness 1.0
-        thickness = ImMax(thickness, 1.0f);
+        // Thicknesses <1.0 should behave like thickness 1.0 (one pixel, see _FringeScale)
+        thickness = ImMax(thickness, AA_SIZE);
         const int integer_thickness = (int)thickness;
         const float fractional_thickness = thickness - integer_thickness;
 
         // Do we want to draw this line using a texture?
         // - For now, only draw integer-width lines using textures to avoid issues with the way scaling occurs, could be improved.
         // - If AA_SIZE is not 1.0f we cannot use the texture path.
-        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f);
+        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
 
         // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
         IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
@@ -696,6 +1617,92 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
         PrimReserve(idx_count, vtx_count);
 
+        // Texture coordinates for the left/right edges of texture-based lines
+        ImVec2 tex_uv0, tex_uv1;
+        if (use_texture)
+            ImDrawListGetTexUvLines(_Data, integer_thickness, fractional_thickness, &tex_uv0, &tex_uv1);
+
+#ifdef IMGUI_ENABLE_SIMD
+        // [SIMD] Same geometry as the three paths below, with vertices written straight from the normals
+        // Each point outputs 2, 3 or 4 vertices along its normal: texture-based edges, center + AA fringes, or solid core + AA fringes.
+        ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
+        ImSimdComputeLineNormals(points, points_count, count, temp_normals);
+        if (!closed)
+            temp_normals[points_count - 1] = temp_normals[points_count - 2];
+
+        const int vtx_per_point = use_texture ? 2 : thick_line ? 4 : 3;
+        float vtx_offsets[4];
+        ImVec2 vtx_uvs[4] = { opaque_uv, opaque_uv, opaque_uv, opaque_uv };
+        ImU32 vtx_cols[4] = { col, col, col, col };
+        if (use_texture)
+        {
+            const float half_draw_size = (thickness * 0.5f) + 1;
+            vtx_offsets[0] = half_draw_size; vtx_uvs[0] = tex_uv0;
+            vtx_offsets[1] = -half_draw_size; vtx_uvs[1] = tex_uv1;
+        }
+        else if (!thick_line)
+        {
+            vtx_offsets[0] = 0.0f;
+            vtx_offsets[1] = AA_SIZE; vtx_cols[1] = col_trans;
+            vtx_offsets[2] = -AA_SIZE; vtx_cols[2] = col_trans;
+        }
+        else
+        {
+            const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+            vtx_offsets[0] = half_inner_thickness + AA_SIZE; vtx_cols[0] = col_trans;
+            vtx_offsets[1] = half_inner_thickness;
+            vtx_offsets[2] = -half_inner_thickness;
+            vtx_offsets[3] = -(half_inner_thickness + AA_SIZE); vtx_cols[3] = col_trans;
+        }
+        _VtxWritePtr = ImSimdWritePolylineVertices(this, _VtxWritePtr, points, points_count, closed, temp_normals, vtx_per_point, vtx_offsets, vtx_uvs, vtx_cols);
+
+        // Indices, same as below. All segments but the last one (which may wrap to the first point) share the same pattern.
+        unsigned int idx1 = _VtxCurrentIdx;
+        int i1 = 0;
+        if (count > IM_SIMD_INDEX_PATTERN_MIN_REPS)
+        {
+            const unsigned int* indices = use_texture ? ImDrawListLineIndicesTex : thick_line ? ImDrawListLineIndicesThick : ImDrawListLineIndicesThin;
+            const int indices_per_segment = use_texture ? 6 : thick_line ? 18 : 12;
+            unsigned int pattern[18], pattern_step[18];
+            for (int n = 0; n < indices_per_segment; n++)
+            {
+                pattern[n] = idx1 + indices[n];
+                pattern_step[n] = (unsigned int)vtx_per_point;
+            }
+            _IdxWritePtr = ImSimdWriteIndexPattern(_IdxWritePtr, count - 1, pattern, pattern_step, indices_per_segment);
+            i1 = count - 1;
+            idx1 += (count - 1) * vtx_per_point;
+        }
+        for (; i1 < count; i1++)
+        {
+            const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + vtx_per_point);
+            if (use_texture)
+            {
+                _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 1);
+                _IdxWritePtr[3] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[4] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0);
+                _IdxWritePtr += 6;
+            }
+            else if (!thick_line)
+            {
+                _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 2);
+                _IdxWritePtr[3] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0);
+                _IdxWritePtr[6] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8] = (ImDrawIdx)(idx1 + 0);
+                _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1);
+                _IdxWritePtr += 12;
+            }
+            else
+            {
+                _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
+                _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
+                _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
+                _IdxWritePtr[9]  = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1);
+                _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
+                _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
+                _IdxWritePtr += 18;
+            }
+            idx1 = idx2;
+        }
+#else
         // Temporary buffer
         // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
         ImVec2* temp_normals = (ImVec2*)alloca(points_count * ((use_texture || !thick_line) ? 3 : 5) * sizeof(ImVec2)); //-V630
@@ -783,21 +1790,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             if (use_texture)
             {
                 // If we're using textures we only need to emit the left/right edge vertices
-                ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
-                if (fractional_thickness != 0.0f)
-                {
-                    const ImVec4 tex_uvs_1 = _Data->TexUvLines[integer_thickness + 1];
-                    tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
-                    tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
-                    tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
-                    tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
-                }
-                ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
-                ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    _VtxWritePtr[0].pos = IM_DRAWLIST_EMIT_POS(this, temp_points[i * 2 + 0]); _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
+                    _VtxWritePtr[1].pos = IM_DRAWLIST_EMIT_POS(this, temp_points[i * 2 + 1]); _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
                     _VtxWritePtr += 2;
                 }
             }
@@ -806,9 +1802,9 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 // If we're not using a texture, we need the center vertex as well
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    _VtxWritePtr[0].pos = IM_DRAWLIST_EMIT_POS(this, points[i]);              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
+                    _VtxWritePtr[1].pos = IM_DRAWLIST_EMIT_POS(this, temp_points[i * 2 + 0]); _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
+                    _VtxWritePtr[2].pos = IM_DRAWLIST_EMIT_POS(this, temp_points[i * 2 + 1]); _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
                     _VtxWritePtr += 3;
                 }
             }
@@ -876,13 +1872,14 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // Add vertices
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                _VtxWritePtr[0].pos = IM_DRAWLIST_EMIT_POS(this, temp_points[i * 4 + 0]); _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
+                _VtxWritePtr[1].pos = IM_DRAWLIST_EMIT_POS(this, temp_points[i * 4 + 1]); _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos = IM_DRAWLIST_EMIT_POS(this, temp_points[i * 4 + 2]); _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos = IM_DRAWLIST_EMIT_POS(this, temp_points[i * 4 + 3]); _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
                 _VtxWritePtr += 4;
             }
         }
+#endif // #ifdef IMGUI_ENABLE_SIMD
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
     else
@@ -904,10 +1901,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            _VtxWritePtr[0].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p1.x + dy, p1.y - dx)); _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[1].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p2.x + dy, p2.y - dx)); _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+            _VtxWritePtr[2].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p2.x - dy, p2.y + dx)); _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+            _VtxWritePtr[3].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p1.x - dy, p1.y + dx)); _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -918,32 +1915,76 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     }
 }
 
-// We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
 {
-    if (points_count < 3)
+    if (points_count < 3 || ImDrawListIsClipped(this, points, points_count, 1.0f))
         return;
 
+    if (Flags & ImDrawListFlags_AntiAliasedFill)
+        PrimReserve((points_count - 2)*3 + points_count * 6, points_count * 2);
+    else
+        PrimReserve((points_count - 2)*3, points_count);
+    _PrimConvexPolyFilled(points, points_count, col);
+}
+
+// Write a filled convex polygon into space reserved with PrimReserve(), see AddConvexPolyFilled() for the index/vertex counts.
+// We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
+void ImDrawList::_PrimConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+{
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
     if (Flags & ImDrawListFlags_AntiAliasedFill)
     {
         // Anti-aliased Fill
-        const float AA_SIZE = 1.0f;
+        const float AA_SIZE = _FringeScale;
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-        const int idx_count = (points_count - 2)*3 + points_count * 6;
         const int vtx_count = (points_count * 2);
-        PrimReserve(idx_count, vtx_count);
 
         // Add indexes for fill
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
         unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
-        for (int i = 2; i < points_count; i++)
+        int i_fill = 2;
+#ifdef IMGUI_ENABLE_SIMD
+        if (points_count - 2 > IM_SIMD_INDEX_PATTERN_MIN_REPS)
+        {
+            const unsigned int fill_pattern[3] = { vtx_inner_idx, vtx_inner_idx + 2, vtx_inner_idx + 4 };
+            const unsigned int fill_pattern_step[3] = { 0, 2, 2 };
+            _IdxWritePtr = ImSimdWriteIndexPattern(_IdxWritePtr, points_count - 2, fill_pattern, fill_pattern_step, 3);
+            i_fill = points_count;
+        }
+#endif
+        for (int i = i_fill; i < points_count; i++)
         {
             _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + ((i - 1) << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx + (i << 1));
             _IdxWritePtr += 3;
         }
 
+#ifdef IMGUI_ENABLE_SIMD
+        // [SIMD] Same geometry as below: the edge normals are those of a closed polyline, and each point outputs
+        // an inner vertex and an outer vertex at -/+ half the AA size along its averaged normal.
+        ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
+        ImSimdComputeLineNormals(points, points_count, points_count, temp_normals);
+        const float vtx_offsets[2] = { -AA_SIZE * 0.5f, AA_SIZE * 0.5f };
+        const ImVec2 vtx_uvs[2] = { uv, uv };
+        const ImU32 vtx_cols[2] = { col, col_trans };
+        _VtxWritePtr = ImSimdWritePolylineVertices(this, _VtxWritePtr, points, points_count, true, temp_normals, 2, vtx_offsets, vtx_uvs, vtx_cols);
+
+        // Add indexes for fringes
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            if (i1 == 1 && points_count - 1 > IM_SIMD_INDEX_PATTERN_MIN_REPS)
+            {
+                // After the edge wrapping from the last point to the first one, edges use the same indices shifted by one point
+                const unsigned int fringe_pattern[6] = { vtx_inner_idx + 2, vtx_inner_idx, vtx_outer_idx, vtx_outer_idx, vtx_outer_idx + 2, vtx_inner_idx + 2 };
+                const unsigned int fringe_pattern_step[6] = { 2, 2, 2, 2, 2, 2 };
+                _IdxWritePtr = ImSimdWriteIndexPattern(_IdxWritePtr, points_count - 1, fringe_pattern, fringe_pattern_step, 6);
+                break;
+            }
+            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+            _IdxWritePtr += 6;
+        }
+#else
         // Compute normals
         ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
@@ -969,8 +2010,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            _VtxWritePtr[0].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(points[i1].x - dm_x, points[i1].y - dm_y)); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+            _VtxWritePtr[1].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(points[i1].x + dm_x, points[i1].y + dm_y)); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -978,17 +2019,16 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
             _IdxWritePtr += 6;
         }
+#endif // #ifdef IMGUI_ENABLE_SIMD
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
     else
     {
         // Non Anti-aliased Fill
-        const int idx_count = (points_count - 2)*3;
         const int vtx_count = points_count;
-        PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[0].pos = IM_DRAWLIST_EMIT_POS(this, points[i]); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
             _VtxWritePtr++;
         }
         for (int i = 2; i < points_count; i++)
@@ -1004,6 +2044,7 @@ void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_
 {
     if (radius == 0.0f || a_min_of_12 > a_max_of_12)
     {
+        IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, _Path, _Path.Size + 1);
         _Path.push_back(center);
         return;
     }
@@ -1015,6 +2056,7 @@ void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_
     a_max_of_12 *= IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER;
 #endif
 
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, _Path, _Path.Size + (a_max_of_12 - a_min_of_12 + 1));
     _Path.reserve(_Path.Size + (a_max_of_12 - a_min_of_12 + 1));
     for (int a = a_min_of_12; a <= a_max_of_12; a++)
     {
@@ -1023,22 +2065,73 @@ void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_
     }
 }
 
+// Write the 'num_segments + 1' points of an arc, see PathArcTo().
+// Arcs starting and ending on multiples of 2*PI/N (e.g. closed circles and polygons) are read from the unit circle with N segments in ImDrawListSharedData::CircleVtx[].
+// Other arcs rotate their first point by a constant angle, and end on the exact last point so adjacent arcs (e.g. pie chart slices) stay connected.
+#define IM_DRAWLIST_ARC_ROTATE_MAX  16
+static void ImDrawListCalcArcPoints(const ImDrawListSharedData* data, const ImVec2& center, float radius, float a_min, float a_max, int num_segments, ImVec2* out_points)
+{
+    const float a_step = (num_segments > 0) ? (a_max - a_min) / (float)num_segments : 0.0f;
+    const float a_step_abs = ImFabs(a_step);
+    if (a_step_abs > (IM_PI * 2.0f) / (IM_DRAWLIST_CIRCLE_VTX_SEGMENT_MAX + 0.5f) && a_step_abs <= (IM_PI * 2.0f) / 2.5f && ImFabs(a_min) < 1024.0f && ImFabs(a_max) < 1024.0f)
+    {
+        const int table_segments = (int)((IM_PI * 2.0f) / a_step_abs + 0.5f);
+        const float table_step = (IM_PI * 2.0f) / (float)table_segments;
+        const int table_first = (int)(a_min / table_step + (a_min >= 0.0f ? 0.5f : -0.5f));
+        const int table_last = (int)(a_max / table_step + (a_max >= 0.0f ? 0.5f : -0.5f));
+        if (table_last - table_first == (a_step > 0.0f ? num_segments : -num_segments) && ImFabs(a_min - (float)table_first * table_step) < 1e-5f && ImFabs(a_max - (float)table_last * table_step) < 1e-5f)
+        {
+            const ImVec2* table = data->CircleVtx + IM_DRAWLIST_CIRCLE_VTX_OFFSET(table_segments);
+            const int table_idx_step = (a_step > 0.0f) ? 1 : table_segments - 1;
+            int table_idx = table_first % table_segments;
+            if (table_idx < 0)
+                table_idx += table_segments;
+            for (int i = 0; i <= num_segments; i++)
+            {
+                out_points[i] = ImVec2(center.x + table[table_idx].x * radius, center.y + table[table_idx].y * radius);
+                table_idx += table_idx_step;
+                if (table_idx >= table_segments)
+                    table_idx -= table_segments;
+            }
+            return;
+        }
+    }
+
+    // Rounding errors accumulate with each rotation, so the current point is recomputed every IM_DRAWLIST_ARC_ROTATE_MAX points
+    float a_cos = 1.0f, a_sin = 0.0f;
+    const float step_cos = ImCos(a_step), step_sin = ImSin(a_step);
+    for (int i = 0; i < num_segments; i++)
+    {
+        if ((i % IM_DRAWLIST_ARC_ROTATE_MAX) == 0)
+        {
+            const float a = a_min + (float)i * a_step;
+            a_cos = ImCos(a);
+            a_sin = ImSin(a);
+        }
+        out_points[i] = ImVec2(center.x + a_cos * radius, center.y + a_sin * radius);
+        const float next_cos = a_cos * step_cos - a_sin * step_sin;
+        a_sin = a_sin * step_cos + a_cos * step_sin;
+        a_cos = next_cos;
+    }
+    out_points[num_segments] = ImVec2(center.x + ImCos(a_max) * radius, center.y + ImSin(a_max) * radius);
+}
+
 void ImDrawList::PathArcTo(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
 {
     if (radius == 0.0f)
     {
+        IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, _Path, _Path.Size + 1);
         _Path.push_back(center);
         return;
     }
+    if (num_segments < 0)
+        return;
 
     // Note that we are adding a point at both a_min and a_max.
     // If you are trying to draw a full closed circle you don't want the overlapping points!
-    _Path.reserve(_Path.Size + (num_segments + 1));
-    for (int i = 0; i <= num_segments; i++)
-    {
-        const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
-        _Path.push_back(ImVec2(center.x + ImCos(a) * radius, center.y + ImSin(a) * radius));
-    }
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, _Path, _Path.Size + (num_segments + 1));
+    _Path.resize(_Path.Size + (num_segments + 1));
+    ImDrawListCalcArcPoints(_Data, center, radius, a_min, a_max, num_segments, _Path.Data + _Path.Size - (num_segments + 1));
 }
 
 ImVec2 ImBezierCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, float t)
@@ -1077,25 +2170,139 @@ static void PathBezierToCasteljau(ImVector<ImVec2>* path, float x1, float y1, fl
     }
 }
 
+ImVec2 ImBezierQuadraticCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, float t)
+{
+    float u = 1.0f - t;
+    float w1 = u*u;
+    float w2 = 2*u*t;
+    float w3 = t*t;
+    return ImVec2(w1*p1.x + w2*p2.x + w3*p3.x, w1*p1.y + w2*p2.y + w3*p3.y);
+}
+
+static void PathBezierQuadraticToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float tess_tol, int level)
+{
+    float dx = x3 - x1;
+    float dy = y3 - y1;
+    float det = (x2 - x3) * dy - (y2 - y3) * dx;
+    if (det * det * 4.0f < tess_tol * (dx * dx + dy * dy))
+    {
+        path->push_back(ImVec2(x3, y3));
+    }
+    else if (level < 10)
+    {
+        float x12 = (x1 + x2)*0.5f,       y12 = (y1 + y2)*0.5f;
+        float x23 = (x2 + x3)*0.5f,       y23 = (y2 + y3)*0.5f;
+        float x123 = (x12 + x23)*0.5f,    y123 = (y12 + y23)*0.5f;
+        PathBezierQuadraticToCasteljau(path, x1, y1,      x12, y12,  x123, y123, tess_tol, level + 1);
+        PathBezierQuadraticToCasteljau(path, x123, y123,  x23, y23,  x3, y3,     tess_tol, level + 1);
+    }
+}
+
+// Flatten a quadratic (order 2) or cubic (order 3) curve starting at (0,0) into 'path', excluding its first point
+static void PathBezierFlatten(ImVector<ImVec2>* path, const ImVec2* ctrl, int order, float tess_tol, int num_segments)
+{
+    const ImVec2 p1(0.0f, 0.0f);
+    if (num_segments == 0)
+    {
+        if (order == 3)
+            PathBezierToCasteljau(path, 0.0f, 0.0f, ctrl[0].x, ctrl[0].y, ctrl[1].x, ctrl[1].y, ctrl[2].x, ctrl[2].y, tess_tol, 0); // Auto-tessellated
+        else
+            PathBezierQuadraticToCasteljau(path, 0.0f, 0.0f, ctrl[0].x, ctrl[0].y, ctrl[1].x, ctrl[1].y, tess_tol, 0);
+    }
+    else
+    {
+        float t_step = 1.0f / (float)num_segments;
+        for (int i_step = 1; i_step <= num_segments; i_step++)
+            path->push_back(order == 3 ? ImBezierCalc(p1, ctrl[0], ctrl[1], ctrl[2], t_step * i_step) : ImBezierQuadraticCalc(p1, ctrl[0], ctrl[1], t_step * i_step));
+    }
+}
+
+// Append the flattened curve to the path, excluding its first point which is already the last point of the path.
+// The curve is flattened relative to its first point, then translated: cached and uncached curves give the same output.
+static void PathBezierToCached(ImDrawList* draw_list, const ImVec2* ctrl_abs, int order, int num_segments)
+{
+    const ImDrawListSharedData* data = draw_list->_Data;
+    ImVector<ImVec2>& path = draw_list->_Path;
+    const ImVec2 p1 = path.back();
+
+    ImDrawListBezierCacheEntry key;
+    memset(&key, 0, sizeof(key));
+    for (int n = 0; n < order; n++)
+        key.Ctrl[n] = ImVec2(ctrl_abs[n].x - p1.x, ctrl_abs[n].y - p1.y);
+    key.TessTol = (num_segments == 0) ? data->CurveTessellationTol * draw_list->_FringeScale * draw_list->_FringeScale : 0.0f; // Squared distance: same tolerance on screen when zoomed with PushTransform()
+    key.NumSegments = num_segments;
+    key.Order = order;
+
+    ImDrawListBezierCache* cache = data->BezierCache;
+    if (IM_DRAWLIST_BEZIER_CACHE_SIZE == 0 || cache == NULL)
+    {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
+        const int path_offset = path.Size;
+        PathBezierFlatten(&path, key.Ctrl, order, key.TessTol, num_segments);
+        for (int n = path_offset; n < path.Size; n++)
+            path.Data[n] = ImVec2(path.Data[n].x + p1.x, path.Data[n].y + p1.y);
+        return;
+    }
+
+    IM_STATIC_ASSERT((IM_DRAWLIST_BEZIER_CACHE_SIZE & (IM_DRAWLIST_BEZIER_CACHE_SIZE - 1)) == 0);
+    if (cache->Entries.Size == 0)
+    {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
+        cache->Entries.resize(IM_DRAWLIST_BEZIER_CACHE_SIZE);
+        cache->Flush();
+    }
+    const size_t key_size = IM_OFFSETOF(ImDrawListBezierCacheEntry, PointsOffset);
+    ImDrawListBezierCacheEntry* entry = &cache->Entries[ImHashData(&key, key_size) & (IM_DRAWLIST_BEZIER_CACHE_SIZE - 1)];
+    if (memcmp(entry, &key, key_size) != 0)
+    {
+        // Miss: flatten into the cache, flushing it first if it is full
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
+        const int points_offset = cache->Points.Size;
+        PathBezierFlatten(&cache->Points, key.Ctrl, order, key.TessTol, num_segments);
+        const int points_count = cache->Points.Size - points_offset;
+        if (points_offset > 0 && cache->Points.Size > IM_DRAWLIST_BEZIER_CACHE_POINTS_MAX)
+        {
+            memmove(cache->Points.Data, cache->Points.Data + points_offset, (size_t)points_count * sizeof(ImVec2));
+            cache->Flush();
+            cache->Points.resize(points_count);
+        }
+        *entry = key;
+        entry->PointsOffset = cache->Points.Size - points_count;
+        entry->PointsCount = points_count;
+    }
+
+    const int path_offset = path.Size;
+    IMGUI_MEM_TAG_GROW(ImGuiMemTag_DrawList, path, path_offset + entry->PointsCount);
+    path.resize(path_offset + entry->PointsCount);
+    const ImVec2* src = cache->Points.Data + entry->PointsOffset;
+    ImVec2* dst = path.Data + path_offset;
+    for (int n = 0; n < entry->PointsCount; n++)
+        dst[n] = ImVec2(src[n].x + p1.x, src[n].y + p1.y);
+}
+
 void ImDrawList::PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments)
 {
-    ImVec2 p1 = _Path.back();
-    if (num_segments == 0)
-    {
-        PathBezierToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, _Data->CurveTessellationTol, 0); // Auto-tessellated
-    }
-    else
-    {
-        float t_step = 1.0f / (float)num_segments;
-        for (int i_step = 1; i_step <= num_segments; i_step++)
-            _Path.push_back(ImBezierCalc(p1, p2, p3, p4, t_step * i_step));
-    }
+    const ImVec2 ctrl[3] = { p2, p3, p4 };
+    PathBezierToCached(this, ctrl, 3, num_segments);
 }
 
-void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawCornerFlags rounding_corners)
+void ImDrawList::PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3, int num_segments)
+{
+    const ImVec2 ctrl[2] = { p2, p3 };
+    PathBezierToCached(this, ctrl, 2, num_segments);
+}
+
+// Rounding actually used by PathRect()
+static inline float ImDrawListCalcRectRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawCornerFlags rounding_corners)
 {
     rounding = ImMin(rounding, ImFabs(b.x - a.x) * ( ((rounding_corners & ImDrawCornerFlags_Top)  == ImDrawCornerFlags_Top)  || ((rounding_corners & ImDrawCornerFlags_Bot)   == ImDrawCornerFlags_Bot)   ? 0.5f : 1.0f ) - 1.0f);
     rounding = ImMin(rounding, ImFabs(b.y - a.y) * ( ((rounding_corners & ImDrawCornerFlags_Left) == ImDrawCornerFlags_Left) || ((rounding_corners & ImDrawCornerFlags_Right) == ImDrawCornerFlags_Right) ? 0.5f : 1.0f ) - 1.0f);
+    return rounding;
+}
+
+void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawCornerFlags rounding_corners)
+{
+    rounding = ImDrawListCalcRectRounding(a, b, rounding, rounding_corners);
 
     if (rounding <= 0.0f || rounding_corners == 0)
     {
@@ -1110,6 +2317,16 @@ void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDr
         const float rounding_tr = (rounding_corners & ImDrawCornerFlags_TopRight) ? rounding : 0.0f;
         const float rounding_br = (rounding_corners & ImDrawCornerFlags_BotRight) ? rounding : 0.0f;
         const float rounding_bl = (rounding_corners & ImDrawCornerFlags_BotLeft) ? rounding : 0.0f;
+        if (_FringeScale != 1.0f)
+        {
+            // Zoomed with PushTransform(): tessellate corners like circles of their size on screen (multiple of 4 segments, so PathArcTo() uses its tables)
+            const int quarter_segments = (ImDrawListCalcCircleFilledSegments(_Data, rounding / _FringeScale, 0) + 3) / 4;
+            PathArcTo(ImVec2(a.x + rounding_tl, a.y + rounding_tl), rounding_tl, IM_PI, IM_PI * 1.5f, quarter_segments);
+            PathArcTo(ImVec2(b.x - rounding_tr, a.y + rounding_tr), rounding_tr, IM_PI * 1.5f, IM_PI * 2.0f, quarter_segments);
+            PathArcTo(ImVec2(b.x - rounding_br, b.y - rounding_br), rounding_br, 0.0f, IM_PI * 0.5f, quarter_segments);
+            PathArcTo(ImVec2(a.x + rounding_bl, b.y - rounding_bl), rounding_bl, IM_PI * 0.5f, IM_PI, quarter_segments);
+            return;
+        }
         PathArcToFast(ImVec2(a.x + rounding_tl, a.y + rounding_tl), rounding_tl, 6, 9);
         PathArcToFast(ImVec2(b.x - rounding_tr, a.y + rounding_tr), rounding_tr, 9, 12);
         PathArcToFast(ImVec2(b.x - rounding_br, b.y - rounding_br), rounding_br, 0, 3);
@@ -1117,21 +2334,44 @@ void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDr
     }
 }
 
-void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness)
+void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness, ImDrawLineFlags flags)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
     PathLineTo(p1 + ImVec2(0.5f, 0.5f));
     PathLineTo(p2 + ImVec2(0.5f, 0.5f));
-    PathStroke(col, false, thickness);
+    PathStroke(col, false, thickness, flags);
 }
 
 // p_min = upper-left, p_max = lower-right
 // Note we don't render 1 pixels sized rectangles properly.
 void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsRectClipped(this, p_min, p_max, ImDrawListCalcStrokePad(thickness)))
         return;
+
+    // Baked round corners: 4 corners and 4 edges quads
+    if (rounding > 0.0f && (rounding_corners & ImDrawCornerFlags_All) == ImDrawCornerFlags_All)
+    {
+        const float rounding_used = ImDrawListCalcRectRounding(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, rounding_corners);
+        ImVec4 tex_uvs;
+        float size;
+        if (rounding_used > 0.0f && ImDrawListGetTexUvRoundCornerStroked(this, rounding_used + 0.5f, thickness, &tex_uvs, &size) && p_max.x - p_min.x >= size * 2.0f && p_max.y - p_min.y >= size * 2.0f)
+        {
+            const ImVec2 uv_outer(tex_uvs.x, tex_uvs.y), uv_inner(tex_uvs.z, tex_uvs.w);
+            PrimReserve(8 * 6, 8 * 4);
+            PrimRectUV(p_min, ImVec2(p_min.x + size, p_min.y + size), uv_outer, uv_inner, col);
+            PrimRectUV(ImVec2(p_max.x, p_min.y), ImVec2(p_max.x - size, p_min.y + size), uv_outer, uv_inner, col);
+            PrimRectUV(p_max, ImVec2(p_max.x - size, p_max.y - size), uv_outer, uv_inner, col);
+            PrimRectUV(ImVec2(p_min.x, p_max.y), ImVec2(p_min.x + size, p_max.y - size), uv_outer, uv_inner, col);
+            PrimRect(ImVec2(p_min.x + size, p_min.y), ImVec2(p_max.x - size, p_min.y + 1.0f), col);
+            PrimRect(ImVec2(p_min.x + size, p_max.y - 1.0f), ImVec2(p_max.x - size, p_max.y), col);
+            PrimRect(ImVec2(p_min.x, p_min.y + size), ImVec2(p_min.x + 1.0f, p_max.y - size), col);
+            PrimRect(ImVec2(p_max.x - 1.0f, p_min.y + size), ImVec2(p_max.x, p_max.y - size), col);
+            return;
+        }
+    }
+
     if (Flags & ImDrawListFlags_AntiAliasedLines)
         PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, rounding_corners);
     else
@@ -1141,10 +2381,29 @@ void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, fl
 
 void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsRectClipped(this, p_min, p_max, 1.0f))
         return;
     if (rounding > 0.0f)
     {
+        // Baked round corners: 4 corners quads (white for corners which are not rounded) and top/middle/bottom bands.
+        // With only some corners rounded the rounding may exceed half the size, the quads would then overlap: use the path instead.
+        const float rounding_used = ImDrawListCalcRectRounding(p_min, p_max, rounding, rounding_corners);
+        ImVec4 tex_uvs;
+        if (rounding_corners != 0 && rounding_used > 0.0f && p_max.x - p_min.x >= rounding_used * 2.0f && p_max.y - p_min.y >= rounding_used * 2.0f && ImDrawListGetTexUvRoundCornerFilled(this, rounding_used, &tex_uvs))
+        {
+            const ImVec2 uv_white = _Data->TexUvWhitePixel;
+            const ImVec2 uv_outer(tex_uvs.x, tex_uvs.y), uv_inner(tex_uvs.z, tex_uvs.w);
+            const float r = rounding_used;
+            PrimReserve(7 * 6, 7 * 4);
+            PrimRectUV(p_min, ImVec2(p_min.x + r, p_min.y + r), (rounding_corners & ImDrawCornerFlags_TopLeft) ? uv_outer : uv_white, (rounding_corners & ImDrawCornerFlags_TopLeft) ? uv_inner : uv_white, col);
+            PrimRectUV(ImVec2(p_max.x, p_min.y), ImVec2(p_max.x - r, p_min.y + r), (rounding_corners & ImDrawCornerFlags_TopRight) ? uv_outer : uv_white, (rounding_corners & ImDrawCornerFlags_TopRight) ? uv_inner : uv_white, col);
+            PrimRectUV(p_max, ImVec2(p_max.x - r, p_max.y - r), (rounding_corners & ImDrawCornerFlags_BotRight) ? uv_outer : uv_white, (rounding_corners & ImDrawCornerFlags_BotRight) ? uv_inner : uv_white, col);
+            PrimRectUV(ImVec2(p_min.x, p_max.y), ImVec2(p_min.x + r, p_max.y - r), (rounding_corners & ImDrawCornerFlags_BotLeft) ? uv_outer : uv_white, (rounding_corners & ImDrawCornerFlags_BotLeft) ? uv_inner : uv_white, col);
+            PrimRect(ImVec2(p_min.x + r, p_min.y), ImVec2(p_max.x - r, p_min.y + r), col);
+            PrimRect(ImVec2(p_min.x, p_min.y + r), ImVec2(p_max.x, p_max.y - r), col);
+            PrimRect(ImVec2(p_min.x + r, p_max.y - r), ImVec2(p_max.x - r, p_max.y), col);
+            return;
+        }
         PathRect(p_min, p_max, rounding, rounding_corners);
         PathFillConvex(col);
     }
@@ -1158,7 +2417,7 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
 // p_min = upper-left, p_max = lower-right
 void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_max, ImU32 col_upr_left, ImU32 col_upr_right, ImU32 col_bot_right, ImU32 col_bot_left)
 {
-    if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
+    if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0 || ImDrawListIsRectClipped(this, p_min, p_max, 0.0f))
         return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
@@ -1219,18 +2478,26 @@ void ImDrawList::AddTriangleFilled(const ImVec2& p1, const ImVec2& p2, const ImV
 
 void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int num_segments, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
+    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f || ImDrawListIsRectClipped(this, center - ImVec2(radius, radius), center + ImVec2(radius, radius), ImDrawListCalcStrokePad(thickness)))
+        return;
+
+    // Baked round corners, unless an explicitly coarser shape was requested
+    ImVec4 tex_uvs;
+    float size;
+    if ((num_segments <= 0 || num_segments >= ImDrawListCalcCircleFilledSegments(_Data, radius, 0)) && ImDrawListGetTexUvRoundCornerStroked(this, radius, thickness, &tex_uvs, &size))
+    {
+        const ImVec2 uv_outer(tex_uvs.x, tex_uvs.y);
+        const float t = radius / size;
+        PrimReserve(24, 9);
+        ImDrawListPrimCircleTex(this, center, radius, uv_outer, ImVec2(uv_outer.x + (tex_uvs.z - uv_outer.x) * t, uv_outer.y + (tex_uvs.w - uv_outer.y) * t), col);
         return;
+    }
 
     // Obtain segment count
     if (num_segments <= 0)
     {
-        // Automatic segment count
-        const int radius_idx = (int)radius - 1;
-        if (radius_idx < IM_ARRAYSIZE(_Data->CircleSegmentCounts))
-            num_segments = _Data->CircleSegmentCounts[radius_idx]; // Use cached value
-        else
-            num_segments = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(radius, _Data->CircleSegmentMaxError);
+        // Automatic segment count, for the radius on screen
+        num_segments = ImDrawListCalcCircleFilledSegments(_Data, radius / _FringeScale, 0);
     }
     else
     {
@@ -1249,18 +2516,23 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
 
 void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col, int num_segments)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
+    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f || ImDrawListIsCircleClipped(this, center, radius))
+        return;
+
+    // Baked round corners, unless an explicitly coarser shape was requested
+    ImVec4 tex_uvs;
+    if ((num_segments <= 0 || num_segments >= ImDrawListCalcCircleFilledSegments(_Data, radius, 0)) && ImDrawListGetTexUvRoundCornerFilled(this, radius, &tex_uvs))
+    {
+        PrimReserve(24, 9);
+        ImDrawListPrimCircleTex(this, center, radius, ImVec2(tex_uvs.x, tex_uvs.y), ImVec2(tex_uvs.z, tex_uvs.w), col);
         return;
+    }
 
     // Obtain segment count
     if (num_segments <= 0)
     {
-        // Automatic segment count
-        const int radius_idx = (int)radius - 1;
-        if (radius_idx < IM_ARRAYSIZE(_Data->CircleSegmentCounts))
-            num_segments = _Data->CircleSegmentCounts[radius_idx]; // Use cached value
-        else
-            num_segments = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(radius, _Data->CircleSegmentMaxError);
+        // Automatic segment count, for the radius on screen
+        num_segments = ImDrawListCalcCircleFilledSegments(_Data, radius / _FringeScale, 0);
     }
     else
     {
@@ -1280,7 +2552,7 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 // Guaranteed to honor 'num_segments'
 void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_segments, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
+    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2 || ImDrawListIsRectClipped(this, center - ImVec2(radius, radius), center + ImVec2(radius, radius), ImDrawListCalcStrokePad(thickness)))
         return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
@@ -1292,7 +2564,7 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
 // Guaranteed to honor 'num_segments'
 void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, int num_segments)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
+    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2 || ImDrawListIsRectClipped(this, center - ImVec2(radius, radius), center + ImVec2(radius, radius), 1.0f))
         return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
@@ -1302,9 +2574,11 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
 }
 
 // Cubic Bezier takes 4 controls points
+// The curve is contained in the bounding box of its control points, which is used for culling before flattening it.
 void ImDrawList::AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    const ImVec2 ctrl_points[4] = { p1, p2, p3, p4 };
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClipped(this, ctrl_points, 4, ImDrawListCalcStrokePad(thickness)))
         return;
 
     PathLineTo(p1);
@@ -1312,6 +2586,18 @@ void ImDrawList::AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2
     PathStroke(col, false, thickness);
 }
 
+// Quadratic Bezier takes 3 controls points
+void ImDrawList::AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments)
+{
+    const ImVec2 ctrl_points[3] = { p1, p2, p3 };
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClipped(this, ctrl_points, 3, ImDrawListCalcStrokePad(thickness)))
+        return;
+
+    PathLineTo(p1);
+    PathBezierQuadraticCurveTo(p2, p3, num_segments);
+    PathStroke(col, false, thickness);
+}
+
 void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
 {
     if ((col & IM_COL32_A_MASK) == 0)
@@ -1348,7 +2634,7 @@ void ImDrawList::AddText(const ImVec2& pos, ImU32 col, const char* text_begin, c
 
 void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsRectClipped(this, p_min, p_max, 0.0f))
         return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
@@ -1364,7 +2650,8 @@ void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, cons
 
 void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& uv1, const ImVec2& uv2, const ImVec2& uv3, const ImVec2& uv4, ImU32 col)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    const ImVec2 points[4] = { p1, p2, p3, p4 };
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClipped(this, points, 4, 0.0f))
         return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
@@ -1380,7 +2667,7 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, con
 
 void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsRectClipped(this, p_min, p_max, 1.0f))
         return;
 
     if (rounding <= 0.0f || (rounding_corners & ImDrawCornerFlags_All) == 0)
@@ -1403,6 +2690,444 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
         PopTextureID();
 }
 
+// Number of vertices that can be reserved at once by batch functions, so they move to a new VtxOffset at the same point individual calls would.
+// 'first_vtx_count' is the vertex count of the next shape to add: PrimReserve() moves to a new VtxOffset when it doesn't fit in the current one.
+static int ImDrawListGetBatchVtxCapacity(const ImDrawList* draw_list, int first_vtx_count)
+{
+    if (sizeof(ImDrawIdx) != 2 || !(draw_list->Flags & ImDrawListFlags_AllowVtxOffset))
+        return INT_MAX;
+    if ((int)draw_list->_VtxCurrentIdx + first_vtx_count >= (1 << 16))
+        return (1 << 16) - 1;
+    return (1 << 16) - 1 - (int)draw_list->_VtxCurrentIdx;
+}
+
+// Same output as AddRectFilled() with no rounding for each rectangle
+void ImDrawList::AddRectFilledBatch(const ImVec2* rects, int rects_count, const ImU32* cols, ImU32 col)
+{
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    for (int n = 0; n < rects_count; )
+    {
+        // Count visible rectangles for the next reservation
+        const int max_count = ImDrawListGetBatchVtxCapacity(this, 4) / 4;
+        int count = 0, n_end = n;
+        for (; n_end < rects_count && count < max_count; n_end++)
+            if (((cols ? cols[n_end] : col) & IM_COL32_A_MASK) != 0 && !ImDrawListIsRectClipped(this, rects[n_end * 2 + 0], rects[n_end * 2 + 1], 1.0f))
+                count++;
+        if (count == 0)
+            break;
+        PrimReserve(count * 6, count * 4);
+
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (; n < n_end; n++)
+        {
+            const ImU32 rect_col = cols ? cols[n] : col;
+            const ImVec2& a = rects[n * 2 + 0];
+            const ImVec2& c = rects[n * 2 + 1];
+            if ((rect_col & IM_COL32_A_MASK) == 0 || ImDrawListIsRectClipped(this, a, c, 1.0f))
+                continue;
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            vtx_write[0].pos = IM_DRAWLIST_EMIT_POS(this, a);                  vtx_write[0].uv = uv; vtx_write[0].col = rect_col;
+            vtx_write[1].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(c.x, a.y));   vtx_write[1].uv = uv; vtx_write[1].col = rect_col;
+            vtx_write[2].pos = IM_DRAWLIST_EMIT_POS(this, c);                  vtx_write[2].uv = uv; vtx_write[2].col = rect_col;
+            vtx_write[3].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(a.x, c.y));   vtx_write[3].uv = uv; vtx_write[3].col = rect_col;
+            vtx_write += 4;
+            idx_write += 6;
+            idx += 4;
+        }
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+    }
+}
+
+// Same output as AddLine() for each line, which is a 2 points AddPolyline(): see AddPolyline() for the vertex layout of each path.
+// We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
+void ImDrawList::AddLinesBatch(const ImVec2* lines, int lines_count, const ImU32* cols, ImU32 col, float thickness)
+{
+    const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const bool thick_line = (thickness > _FringeScale);
+    const float pad = ImDrawListCalcStrokePad(thickness);
+
+    // Per-point vertices of anti-aliased lines: offset along the normal, uv, and whether the vertex uses the transparent color
+    int vtx_per_point = 2;
+    float vtx_offsets[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    ImVec2 vtx_uvs[4] = { opaque_uv, opaque_uv, opaque_uv, opaque_uv };
+    bool vtx_trans[4] = { false, false, false, false };
+    const unsigned int* indices = NULL;
+    int idx_per_line = 6;
+    if (anti_aliased)
+    {
+        const float AA_SIZE = _FringeScale;
+        thickness = ImMax(thickness, AA_SIZE);
+        const int integer_thickness = (int)thickness;
+        const float fractional_thickness = thickness - integer_thickness;
+        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+        if (use_texture)
+        {
+            const float half_draw_size = (thickness * 0.5f) + 1;
+            ImDrawListGetTexUvLines(_Data, integer_thickness, fractional_thickness, &vtx_uvs[0], &vtx_uvs[1]);
+            vtx_offsets[0] = half_draw_size;
+            vtx_offsets[1] = -half_draw_size;
+            indices = ImDrawListLineIndicesTex;
+        }
+        else if (!thick_line)
+        {
+            vtx_per_point = 3;
+            vtx_offsets[1] = AA_SIZE; vtx_trans[1] = true;
+            vtx_offsets[2] = -AA_SIZE; vtx_trans[2] = true;
+            indices = ImDrawListLineIndicesThin;
+            idx_per_line = 12;
+        }
+        else
+        {
+            const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+            vtx_per_point = 4;
+            vtx_offsets[0] = half_inner_thickness + AA_SIZE; vtx_trans[0] = true;
+            vtx_offsets[1] = half_inner_thickness;
+            vtx_offsets[2] = -half_inner_thickness;
+            vtx_offsets[3] = -(half_inner_thickness + AA_SIZE); vtx_trans[3] = true;
+            indices = ImDrawListLineIndicesThick;
+            idx_per_line = 18;
+        }
+    }
+    const int vtx_per_line = vtx_per_point * 2;
+
+    for (int n = 0; n < lines_count; )
+    {
+        // Count visible lines for the next reservation
+        const int max_count = ImDrawListGetBatchVtxCapacity(this, vtx_per_line) / vtx_per_line;
+        int count = 0, n_end = n;
+        for (; n_end < lines_count && count < max_count; n_end++)
+            if (((cols ? cols[n_end] : col) & IM_COL32_A_MASK) != 0 && !ImDrawListIsLineClipped(this, lines[n_end * 2 + 0], lines[n_end * 2 + 1], pad))
+                count++;
+        if (count == 0)
+            break;
+        PrimReserve(count * idx_per_line, count * vtx_per_line);
+
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (; n < n_end; n++)
+        {
+            const ImU32 line_col = cols ? cols[n] : col;
+            if ((line_col & IM_COL32_A_MASK) == 0 || ImDrawListIsLineClipped(this, lines[n * 2 + 0], lines[n * 2 + 1], pad))
+                continue;
+            const float p1x = lines[n * 2 + 0].x + 0.5f, p1y = lines[n * 2 + 0].y + 0.5f;
+            const float p2x = lines[n * 2 + 1].x + 0.5f, p2y = lines[n * 2 + 1].y + 0.5f;
+            float dx = p2x - p1x;
+            float dy = p2y - p1y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+
+            if (anti_aliased)
+            {
+                // First point uses the segment normal, second point the fixed up average of the (identical) normals of an open line end
+                const ImU32 line_col_trans = line_col & ~IM_COL32_A_MASK;
+                const float n1x = dy, n1y = -dx;
+                float n2x = (n1x + n1x) * 0.5f;
+                float n2y = (n1y + n1y) * 0.5f;
+                IM_FIXNORMAL2F(n2x, n2y);
+                for (int k = 0; k < vtx_per_point; k++)
+                {
+                    const float offset = vtx_offsets[k];
+                    const ImU32 vtx_col = vtx_trans[k] ? line_col_trans : line_col;
+                    ImDrawVert* v1 = &vtx_write[k];
+                    ImDrawVert* v2 = &vtx_write[vtx_per_point + k];
+                    if (offset == 0.0f)
+                    {
+                        v1->pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p1x, p1y));
+                        v2->pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p2x, p2y));
+                    }
+                    else
+                    {
+                        v1->pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p1x + n1x * offset, p1y + n1y * offset));
+                        v2->pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p2x + n2x * offset, p2y + n2y * offset));
+                    }
+                    v1->uv = vtx_uvs[k]; v1->col = vtx_col;
+                    v2->uv = vtx_uvs[k]; v2->col = vtx_col;
+                }
+                for (int i = 0; i < idx_per_line; i++)
+                    idx_write[i] = (ImDrawIdx)(idx + indices[i]);
+            }
+            else
+            {
+                dx *= (thickness * 0.5f);
+                dy *= (thickness * 0.5f);
+                vtx_write[0].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p1x + dy, p1y - dx)); vtx_write[0].uv = opaque_uv; vtx_write[0].col = line_col;
+                vtx_write[1].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p2x + dy, p2y - dx)); vtx_write[1].uv = opaque_uv; vtx_write[1].col = line_col;
+                vtx_write[2].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p2x - dy, p2y + dx)); vtx_write[2].uv = opaque_uv; vtx_write[2].col = line_col;
+                vtx_write[3].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(p1x - dy, p1y + dx)); vtx_write[3].uv = opaque_uv; vtx_write[3].col = line_col;
+                idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+                idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            }
+            vtx_write += vtx_per_line;
+            idx_write += idx_per_line;
+            idx += vtx_per_line;
+        }
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+    }
+}
+
+// Same output as AddCircleFilled() for each circle.
+// Points of the unit circle are computed once per segment count, then each circle is written with _PrimConvexPolyFilled(), or as baked round corners.
+void ImDrawList::AddCirclesFilledBatch(const ImVec2* centers, const float* radii, int circles_count, const ImU32* cols, ImU32 col, float radius, int num_segments)
+{
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    if (num_segments > 0)
+        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+
+    // 12 segments use PathArcToFast(center, radius, 0, 12 - 1), others use PathArcTo(center, radius, 0.0f, a_max, num_segments - 1)
+    const int arc_fast_points_count = (12 - 1) * IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER + 1;
+    const int max_points_count = ImMax(arc_fast_points_count, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+    ImVec2* unit_points = (ImVec2*)alloca(max_points_count * 2 * sizeof(ImVec2)); //-V630
+    ImVec2* points = unit_points + max_points_count;
+    int unit_segments = 0;
+    ImVec4 tex_uvs;
+
+    for (int n = 0; n < circles_count; )
+    {
+        // Count visible circles and their vertices/indices for the next reservation
+        int vtx_capacity = -1, vtx_count = 0, idx_count = 0, n_end = n;
+        for (; n_end < circles_count; n_end++)
+        {
+            const float circle_radius = radii ? radii[n_end] : radius;
+            if (((cols ? cols[n_end] : col) & IM_COL32_A_MASK) == 0 || circle_radius <= 0.0f || ImDrawListIsCircleClipped(this, centers[n_end], circle_radius))
+                continue;
+            const int segments = ImDrawListCalcCircleFilledSegments(_Data, circle_radius / _FringeScale, num_segments);
+            const int points_count = (segments == 12) ? arc_fast_points_count : segments;
+            const bool use_tex = (num_segments <= 0 || segments >= ImDrawListCalcCircleFilledSegments(_Data, circle_radius, 0)) && ImDrawListGetTexUvRoundCornerFilled(this, circle_radius, &tex_uvs);
+            const int circle_vtx_count = use_tex ? 9 : anti_aliased ? points_count * 2 : points_count;
+            if (vtx_capacity < 0)
+                vtx_capacity = ImDrawListGetBatchVtxCapacity(this, circle_vtx_count);
+            if (vtx_count + circle_vtx_count > vtx_capacity)
+                break;
+            vtx_count += circle_vtx_count;
+            idx_count += use_tex ? 24 : anti_aliased ? (points_count - 2) * 3 + points_count * 6 : (points_count - 2) * 3;
+        }
+        if (vtx_count == 0)
+            break;
+        PrimReserve(idx_count, vtx_count);
+
+        for (; n < n_end; n++)
+        {
+            const ImU32 circle_col = cols ? cols[n] : col;
+            const float circle_radius = radii ? radii[n] : radius;
+            if ((circle_col & IM_COL32_A_MASK) == 0 || circle_radius <= 0.0f || ImDrawListIsCircleClipped(this, centers[n], circle_radius))
+                continue;
+            const int segments = ImDrawListCalcCircleFilledSegments(_Data, circle_radius / _FringeScale, num_segments);
+            if ((num_segments <= 0 || segments >= ImDrawListCalcCircleFilledSegments(_Data, circle_radius, 0)) && ImDrawListGetTexUvRoundCornerFilled(this, circle_radius, &tex_uvs))
+            {
+                ImDrawListPrimCircleTex(this, centers[n], circle_radius, ImVec2(tex_uvs.x, tex_uvs.y), ImVec2(tex_uvs.z, tex_uvs.w), circle_col);
+                continue;
+            }
+            const int points_count = (segments == 12) ? arc_fast_points_count : segments;
+            if (segments != unit_segments)
+            {
+                if (segments == 12)
+                {
+                    for (int a = 0; a < points_count; a++)
+                        unit_points[a] = _Data->ArcFastVtx[a % IM_ARRAYSIZE(_Data->ArcFastVtx)];
+                }
+                else
+                {
+                    // Because we are filling a closed shape we remove 1 from the count of segments/points
+                    const float a_max = (IM_PI * 2.0f) * ((float)segments - 1.0f) / (float)segments;
+                    ImDrawListCalcArcPoints(_Data, ImVec2(0.0f, 0.0f), 1.0f, 0.0f, a_max, segments - 1, unit_points);
+                }
+                unit_segments = segments;
+            }
+            const ImVec2 center = centers[n];
+            for (int i = 0; i < points_count; i++)
+                points[i] = ImVec2(center.x + unit_points[i].x * circle_radius, center.y + unit_points[i].y * circle_radius);
+            _PrimConvexPolyFilled(points, points_count, circle_col);
+        }
+    }
+}
+
+// Same output as AddBezierCurve() for each visible curve.
+// A curve is contained in the bounding box of its control points, so with ImDrawListFlags_CullClipped curves outside of the clip rectangle are skipped without being flattened.
+void ImDrawList::AddBezierCurvesBatch(const ImVec2* curves, int curves_count, const ImU32* cols, ImU32 col, float thickness, int num_segments)
+{
+    const float pad = ImDrawListCalcStrokePad(thickness);
+    for (int n = 0; n < curves_count; n++)
+    {
+        const ImU32 curve_col = cols ? cols[n] : col;
+        const ImVec2* p = &curves[n * 4];
+        if ((curve_col & IM_COL32_A_MASK) == 0 || ImDrawListIsClipped(this, p, 4, pad))
+            continue;
+        PathLineTo(p[0]);
+        PathBezierCurveTo(p[1], p[2], p[3], num_segments);
+        PathStroke(curve_col, false, thickness);
+    }
+}
+
+// Same output as AddImage() for each image
+void ImDrawList::AddImagesBatch(ImTextureID user_texture_id, const ImVec2* rects, const ImVec2* uvs, int images_count, const ImU32* cols, ImU32 col)
+{
+    bool push_texture_id = false;
+    for (int n = 0; n < images_count; )
+    {
+        // Count visible images for the next reservation
+        int count = 0, n_end = n;
+        if (!push_texture_id && user_texture_id != _CmdHeader.TextureId)
+        {
+            for (; n_end < images_count && count == 0; n_end++)
+                if (((cols ? cols[n_end] : col) & IM_COL32_A_MASK) != 0 && !ImDrawListIsRectClipped(this, rects[n_end * 2 + 0], rects[n_end * 2 + 1], 0.0f))
+                    count++;
+            if (count == 0)
+                break;
+            PushTextureID(user_texture_id);
+            push_texture_id = true;
+        }
+        const int max_count = ImDrawListGetBatchVtxCapacity(this, 4) / 4;
+        for (; n_end < images_count && count < max_count; n_end++)
+            if (((cols ? cols[n_end] : col) & IM_COL32_A_MASK) != 0 && !ImDrawListIsRectClipped(this, rects[n_end * 2 + 0], rects[n_end * 2 + 1], 0.0f))
+                count++;
+        if (count == 0)
+            break;
+        PrimReserve(count * 6, count * 4);
+
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (; n < n_end; n++)
+        {
+            const ImU32 image_col = cols ? cols[n] : col;
+            const ImVec2& a = rects[n * 2 + 0];
+            const ImVec2& c = rects[n * 2 + 1];
+            if ((image_col & IM_COL32_A_MASK) == 0 || ImDrawListIsRectClipped(this, a, c, 0.0f))
+                continue;
+            const ImVec2 uv_a = uvs ? uvs[n * 2 + 0] : ImVec2(0, 0);
+            const ImVec2 uv_c = uvs ? uvs[n * 2 + 1] : ImVec2(1, 1);
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            vtx_write[0].pos = IM_DRAWLIST_EMIT_POS(this, a);                  vtx_write[0].uv = uv_a;                    vtx_write[0].col = image_col;
+            vtx_write[1].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(c.x, a.y));   vtx_write[1].uv = ImVec2(uv_c.x, uv_a.y);  vtx_write[1].col = image_col;
+            vtx_write[2].pos = IM_DRAWLIST_EMIT_POS(this, c);                  vtx_write[2].uv = uv_c;                    vtx_write[2].col = image_col;
+            vtx_write[3].pos = IM_DRAWLIST_EMIT_POS(this, ImVec2(a.x, c.y));   vtx_write[3].uv = ImVec2(uv_a.x, uv_c.y);  vtx_write[3].col = image_col;
+            vtx_write += 4;
+            idx_write += 6;
+            idx += 4;
+        }
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+    }
+
+    if (push_texture_id)
+        PopTextureID();
+}
+
+// Append commands with their vertices and indices, from a recorded fragment or another draw list. Vertices sharing the same
+// VtxOffset in the source are copied with a single PrimReserve(), then indices of each command are rebased on the first of them.
+static void ImDrawListAppendCommands(ImDrawList* draw_list, const ImVector<ImDrawCmd>& src_cmds, const ImVector<ImDrawIdx>& src_idx, const ImVector<ImDrawVert>& src_vtx, const ImVec2& offset)
+{
+    const ImVec4 backup_clip_rect = draw_list->_CmdHeader.ClipRect;
+    const ImTextureID backup_texture_id = draw_list->_CmdHeader.TextureId;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const bool translate = (offset.x != 0.0f || offset.y != 0.0f || draw_list->_EmitTransform != NULL); // Vertices need IM_DRAWLIST_EMIT_POS()
+#else
+    const bool translate = (offset.x != 0.0f || offset.y != 0.0f);
+#endif
+    int vtx_offset = -1;            // Source VtxOffset of the vertices copied last
+    unsigned int vtx_base = 0;      // Index of the first of them in this draw list
+    for (int cmd_n = 0; cmd_n < src_cmds.Size; cmd_n++)
+    {
+        const ImDrawCmd& cmd = src_cmds[cmd_n];
+        if (cmd.UserCallback != NULL)
+        {
+            draw_list->AddCallback(cmd.UserCallback, cmd.UserCallbackData);
+            continue;
+        }
+
+        // Translate clip rectangle and intersect it with the current one (same as PushClipRect() with intersect_with_current_clip_rect)
+        ImVec4 cr(cmd.ClipRect.x + offset.x, cmd.ClipRect.y + offset.y, cmd.ClipRect.z + offset.x, cmd.ClipRect.w + offset.y);
+        cr.x = ImMax(cr.x, backup_clip_rect.x);
+        cr.y = ImMax(cr.y, backup_clip_rect.y);
+        cr.z = ImMin(cr.z, backup_clip_rect.z);
+        cr.w = ImMin(cr.w, backup_clip_rect.w);
+        cr.z = ImMax(cr.x, cr.z);
+        cr.w = ImMax(cr.y, cr.w);
+        draw_list->_CmdHeader.ClipRect = cr;
+        draw_list->_OnChangedClipRect();
+        draw_list->_CmdHeader.TextureId = cmd.TextureId;
+        draw_list->_OnChangedTextureID();
+
+        // Copy vertices of this command and of the following ones using the same VtxOffset
+        if ((int)cmd.VtxOffset != vtx_offset)
+        {
+            vtx_offset = (int)cmd.VtxOffset;
+            int vtx_end = src_vtx.Size;
+            for (int next_cmd_n = cmd_n + 1; next_cmd_n < src_cmds.Size; next_cmd_n++)
+                if (src_cmds[next_cmd_n].UserCallback == NULL && (int)src_cmds[next_cmd_n].VtxOffset != vtx_offset)
+                {
+                    vtx_end = (int)src_cmds[next_cmd_n].VtxOffset;
+                    break;
+                }
+            const int vtx_count = vtx_end - vtx_offset;
+            draw_list->PrimReserve(0, vtx_count);
+            const ImDrawVert* vtx_src = src_vtx.Data + vtx_offset;
+            if (translate)
+            {
+                for (int n = 0; n < vtx_count; n++)
+                {
+                    const ImVec2 pos = vtx_src[n].pos;
+                    draw_list->_VtxWritePtr[n].pos = IM_DRAWLIST_EMIT_POS(draw_list, ImVec2(pos.x + offset.x, pos.y + offset.y));
+                    draw_list->_VtxWritePtr[n].uv = vtx_src[n].uv;
+                    draw_list->_VtxWritePtr[n].col = vtx_src[n].col;
+                }
+            }
+            else
+            {
+                memcpy(draw_list->_VtxWritePtr, vtx_src, (size_t)vtx_count * sizeof(ImDrawVert));
+            }
+            draw_list->_VtxWritePtr += vtx_count;
+            vtx_base = draw_list->_VtxCurrentIdx;
+            draw_list->_VtxCurrentIdx += vtx_count;
+        }
+
+        // Copy indices. Not using PrimReserve() as it could move to a new VtxOffset, which only vertices can require.
+        if (cmd.ElemCount == 0)
+            continue;
+        const int idx_buffer_old_size = draw_list->IdxBuffer.Size;
+        draw_list->IdxBuffer.resize(idx_buffer_old_size + (int)cmd.ElemCount);
+        draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1].ElemCount += cmd.ElemCount;
+        const ImDrawIdx* idx_src = src_idx.Data + cmd.IdxOffset;
+        ImDrawIdx* idx_dst = draw_list->IdxBuffer.Data + idx_buffer_old_size;
+        for (unsigned int n = 0; n < cmd.ElemCount; n++)
+            idx_dst[n] = (ImDrawIdx)(idx_src[n] + vtx_base);
+        draw_list->_IdxWritePtr = idx_dst + cmd.ElemCount;
+    }
+
+    draw_list->_CmdHeader.ClipRect = backup_clip_rect;
+    draw_list->_OnChangedClipRect();
+    draw_list->_CmdHeader.TextureId = backup_texture_id;
+    draw_list->_OnChangedTextureID();
+}
+
+// Append a recorded fragment
+void ImDrawList::AddFragment(const ImDrawListFragment& fragment, const ImVec2& offset)
+{
+    IM_ASSERT(fragment._DrawList == NULL && "Fragment is being recorded");
+    if (fragment.CmdBuffer.Size == 0)
+        return;
+    ImDrawListAppendCommands(this, fragment.CmdBuffer, fragment.IdxBuffer, fragment.VtxBuffer, offset);
+}
+
+// Append the output of another draw list, e.g. filled on another thread. Its clip rectangle and texture stacks are ignored.
+void ImDrawList::AddDrawList(const ImDrawList* draw_list, const ImVec2& offset)
+{
+    IM_ASSERT(draw_list != this);
+    if (draw_list->CmdBuffer.Size == 0)
+        return;
+    ImDrawListAppendCommands(this, draw_list->CmdBuffer, draw_list->IdxBuffer, draw_list->VtxBuffer, offset);
+}
+
 
 //-----------------------------------------------------------------------------
 // ImDrawListSplitter
@@ -1427,6 +3152,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
         _Channels.resize(channels_count);
@@ -1458,6 +3184,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
@@ -1465,11 +3192,9 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate our final buffer sizes (commands count is an upper bound, as the first command of a channel may be merged with the previous one)
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
@@ -1477,40 +3202,43 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
         // Equivalent of PopUnusedDrawCmd() for this channel's cmdbuffer and except we don't need to test for UserCallback.
         if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0)
             ch._CmdBuffer.pop_back();
-
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    const int cmd_base = draw_list->CmdBuffer.Size;
+    draw_list->CmdBuffer.resize(cmd_base + new_cmd_buffer_count);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
-    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices).
+    // Commands are written once with their final IdxOffset, merging the first command of a channel into the previous one if matching.
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + cmd_base;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawCmd* last_cmd = (cmd_base > 0) ? cmd_write - 1 : NULL;
+    unsigned int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        const ImDrawCmd* cmd_read = ch._CmdBuffer.Data;
+        const ImDrawCmd* cmd_read_end = cmd_read + ch._CmdBuffer.Size;
+        if (cmd_read < cmd_read_end && last_cmd != NULL && ImDrawCmd_HeaderCompare(last_cmd, cmd_read) == 0 && last_cmd->UserCallback == NULL && cmd_read->UserCallback == NULL)
+        {
+            last_cmd->ElemCount += cmd_read->ElemCount;
+            idx_offset += cmd_read->ElemCount;
+            cmd_read++;
+        }
+        if (const int sz = (int)(cmd_read_end - cmd_read))
+        {
+            memcpy(cmd_write, cmd_read, sz * sizeof(ImDrawCmd));
+            for (ImDrawCmd* cmd_write_end = cmd_write + sz; cmd_write < cmd_write_end; cmd_write++)
+            {
+                cmd_write->IdxOffset = idx_offset;
+                idx_offset += cmd_write->ElemCount;
+            }
+            last_cmd = cmd_write - 1;
+        }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
+    draw_list->CmdBuffer.resize((int)(cmd_write - draw_list->CmdBuffer.Data));
     draw_list->_IdxWritePtr = idx_write;
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
@@ -1549,6 +3277,64 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
         draw_list->AddDrawCmd();
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawListFragment
+//-----------------------------------------------------------------------------
+
+void ImDrawListFragment::Begin(ImDrawList* draw_list)
+{
+    IM_ASSERT(_DrawList == NULL && "Mismatched Begin()/End() calls");
+    _DrawList = draw_list;
+    _BeginCmd = draw_list->CmdBuffer.Size - 1;
+    _BeginIdx = draw_list->IdxBuffer.Size;
+    _BeginVtx = draw_list->VtxBuffer.Size;
+}
+
+void ImDrawListFragment::End(ImDrawList* draw_list)
+{
+    IM_ASSERT(_DrawList == draw_list && "Mismatched Begin()/End() calls");
+    IM_ASSERT(draw_list->IdxBuffer.Size >= _BeginIdx && draw_list->VtxBuffer.Size >= _BeginVtx);
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
+    _DrawList = NULL;
+    Clear();
+
+    const int idx_count = draw_list->IdxBuffer.Size - _BeginIdx;
+    const int vtx_count = draw_list->VtxBuffer.Size - _BeginVtx;
+    IdxBuffer.resize(idx_count);
+    VtxBuffer.resize(vtx_count);
+    if (idx_count > 0)
+        memcpy(IdxBuffer.Data, draw_list->IdxBuffer.Data + _BeginIdx, (size_t)idx_count * sizeof(ImDrawIdx));
+    if (vtx_count > 0)
+        memcpy(VtxBuffer.Data, draw_list->VtxBuffer.Data + _BeginVtx, (size_t)vtx_count * sizeof(ImDrawVert));
+
+    // Copy the part of each command after Begin(). The command which was current on Begin() may have been merged into the previous one since
+    // (when empty, by a PushClipRect()/PushTextureID() restoring the previous settings), so scan from that one: elements before Begin() are skipped.
+    for (int cmd_n = ImMax(_BeginCmd - 1, 0); cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        ImDrawCmd cmd = draw_list->CmdBuffer[cmd_n];
+        const int elem_start = ImMax((int)cmd.IdxOffset, _BeginIdx);
+        const int elem_end = (int)(cmd.IdxOffset + cmd.ElemCount);
+        if (elem_end <= elem_start && (cmd.UserCallback == NULL || cmd_n <= _BeginCmd))
+            continue;
+        cmd.IdxOffset = (unsigned int)(elem_start - _BeginIdx);
+        cmd.ElemCount = (unsigned int)ImMax(elem_end - elem_start, 0);
+
+        // Make VtxOffset relative to the fragment vertices. Commands started before Begin() have their indices rebased instead.
+        if ((int)cmd.VtxOffset < _BeginVtx)
+        {
+            const unsigned int rebase = (unsigned int)_BeginVtx - cmd.VtxOffset;
+            for (ImDrawIdx* idx = IdxBuffer.Data + cmd.IdxOffset, *idx_end = idx + cmd.ElemCount; idx < idx_end; idx++)
+                *idx = (ImDrawIdx)(*idx - rebase);
+            cmd.VtxOffset = 0;
+        }
+        else
+        {
+            cmd.VtxOffset -= (unsigned int)_BeginVtx;
+        }
+        CmdBuffer.push_back(cmd);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawData
 //-----------------------------------------------------------------------------
@@ -1572,6 +3358,70 @@ void ImDrawData::DeIndexAllBuffers()
     }
 }
 
+// Copy all draw lists into a single one, so the back-end can upload a single vertex/index buffer and issue fewer draw calls.
+// - Consecutive commands sharing the same clip rectangle, texture and vertex offset are merged, including across draw lists.
+// - Indices are rebased to address the combined vertex buffer. With 16-bit indices, a new ImDrawCmd::VtxOffset base is started
+//   whenever vertices can't be addressed from the current one, which requires 'allow_vtx_offset' (ImGuiBackendFlags_RendererHasVtxOffset).
+// - Callbacks are kept in order but will receive 'out_list' as their parent list.
+// Return false and leave 'out_list' untouched if the vertices can't be addressed.
+bool ImDrawData::MergeCmdLists(ImDrawList* out_list, bool allow_vtx_offset) const
+{
+    if (sizeof(ImDrawIdx) == 2 && !allow_vtx_offset && TotalVtxCount > (1 << 16))
+        return false;
+
+    int cmd_count = 0;
+    for (int i = 0; i < CmdListsCount; i++)
+        cmd_count += CmdLists[i]->CmdBuffer.Size;
+    out_list->CmdBuffer.resize(cmd_count);
+    out_list->VtxBuffer.resize(TotalVtxCount);
+    out_list->IdxBuffer.resize(TotalIdxCount);
+
+    ImDrawVert* vtx_write = out_list->VtxBuffer.Data;
+    ImDrawIdx* idx_write = out_list->IdxBuffer.Data;
+    ImDrawCmd* cmd_write = out_list->CmdBuffer.Data;
+    ImDrawCmd* last_cmd = NULL;
+    unsigned int vtx_base = 0;      // Offset of the current draw list vertices in out_list->VtxBuffer
+    unsigned int vtx_offset = 0;    // VtxOffset of output commands, indices are rebased relative to it
+    for (int i = 0; i < CmdListsCount; i++)
+    {
+        const ImDrawList* cmd_list = CmdLists[i];
+        if (cmd_list->VtxBuffer.Size > 0)
+            memcpy(vtx_write, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        const unsigned int vtx_end = vtx_base + (unsigned int)cmd_list->VtxBuffer.Size;
+        for (const ImDrawCmd* src_cmd = cmd_list->CmdBuffer.Data; src_cmd < cmd_list->CmdBuffer.Data + cmd_list->CmdBuffer.Size; src_cmd++)
+        {
+            if (src_cmd->ElemCount == 0 && src_cmd->UserCallback == NULL)
+                continue;
+
+            // Indices of a command address at most 64K vertices from its own VtxOffset
+            const unsigned int cmd_vtx_base = vtx_base + src_cmd->VtxOffset;
+            if (sizeof(ImDrawIdx) == 2 && ImMin(vtx_end, cmd_vtx_base + (1 << 16)) - vtx_offset > (1 << 16))
+                vtx_offset = cmd_vtx_base;
+            const unsigned int idx_delta = cmd_vtx_base - vtx_offset;
+            const ImDrawIdx* idx_read = cmd_list->IdxBuffer.Data + src_cmd->IdxOffset;
+            if (idx_delta == 0)
+                memcpy(idx_write, idx_read, (size_t)src_cmd->ElemCount * sizeof(ImDrawIdx));
+            else
+                for (unsigned int n = 0; n < src_cmd->ElemCount; n++)
+                    idx_write[n] = (ImDrawIdx)(idx_read[n] + idx_delta);
+
+            *cmd_write = *src_cmd;
+            cmd_write->VtxOffset = vtx_offset;
+            cmd_write->IdxOffset = (unsigned int)(idx_write - out_list->IdxBuffer.Data);
+            if (last_cmd != NULL && last_cmd->UserCallback == NULL && cmd_write->UserCallback == NULL && ImDrawCmd_HeaderCompare(last_cmd, cmd_write) == 0)
+                last_cmd->ElemCount += cmd_write->ElemCount;
+            else
+                last_cmd = cmd_write++;
+            idx_write += src_cmd->ElemCount;
+        }
+        vtx_write += cmd_list->VtxBuffer.Size;
+        vtx_base = vtx_end;
+    }
+    out_list->CmdBuffer.resize((int)(cmd_write - out_list->CmdBuffer.Data));
+    out_list->IdxBuffer.resize((int)(idx_write - out_list->IdxBuffer.Data));
+    return true;
+}
+
 // Helper to scale the ClipRect field of each ImDrawCmd.
 // Use if your final output buffer is at a different scale than draw_data->DisplaySize,
 // or if there is a difference between your window resolution and framebuffer resolution.
@@ -1607,7 +3457,7 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
     for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
     {
-        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float d = ImDot(IM_DRAWLIST_READ_POS(draw_list, vert->pos) - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
         int r = (int)(col0_r + col_delta_r * t);
         int g = (int)(col0_g + col_delta_g * t);
@@ -1632,12 +3482,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            vertex->uv = ImClamp(uv_a + ImMul(IM_DRAWLIST_READ_POS(draw_list, vertex->pos) - a, scale), min, max);
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            vertex->uv = uv_a + ImMul(IM_DRAWLIST_READ_POS(draw_list, vertex->pos) - a, scale);
     }
 }
 
@@ -1733,7 +3583,7 @@ ImFontAtlas::ImFontAtlas()
     TexWidth = TexHeight = 0;
     TexUvScale = ImVec2(0.0f, 0.0f);
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -1761,7 +3611,7 @@ void    ImFontAtlas::ClearInputData()
         }
     ConfigData.clear();
     CustomRects.clear();
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
 }
 
 void    ImFontAtlas::ClearTexData()
@@ -2078,6 +3928,8 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
 bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_FontAtlasBuild);
+    IMGUI_PROFILER_SCOPE_NAMED(profiler_step, ImGuiProfilerPhase_FontAtlasGlyphLookup);
 
     ImFontAtlasBuildInit(atlas);
 
@@ -2177,6 +4029,7 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     memset(buf_packedchars.Data, 0, (size_t)buf_packedchars.size_in_bytes());
 
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
+    IMGUI_PROFILER_SCOPE_NEXT(profiler_step, ImGuiProfilerPhase_FontAtlasPackRects);
     int total_surface = 0;
     int buf_rects_out_n = 0;
     int buf_packedchars_out_n = 0;
@@ -2250,6 +4103,7 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 7. Allocate texture
+    IMGUI_PROFILER_SCOPE_NEXT(profiler_step, ImGuiProfilerPhase_FontAtlasRasterize);
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
@@ -2285,6 +4139,7 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
+    IMGUI_PROFILER_SCOPE_NEXT(profiler_step, ImGuiProfilerPhase_FontAtlasFinish);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
@@ -2435,6 +4290,56 @@ static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
     }
 }
 
+// Baked round corner 'n': filled corners of radius 1 to IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX,
+// followed by 1 pixel wide stroked corners of outer radius 1.0f to IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX + 0.5f by 0.5f steps.
+#define IM_FONTATLAS_ROUND_CORNERS_COUNT    (IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 3)
+static float ImFontAtlasGetRoundCornerRadius(int n, bool* out_stroked)
+{
+    *out_stroked = (n >= IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX);
+    return *out_stroked ? (float)(n - IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX + 2) * 0.5f : (float)(n + 1);
+}
+
+static void ImFontAtlasBuildRenderRoundCornersTexData(ImFontAtlas* atlas)
+{
+    if (atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners)
+        return;
+
+    // Each corner is the top-left quarter of a circle centered on (radius, radius), continued by straight edges up to its center.
+    // A 1 pixel border is added around it: empty on the outer sides, and continuing the shape on the inner sides so that bilinear
+    // filtering never samples outside of the rectangle, which isn't padded by the packer. Coverage is sampled at pixel centers.
+    for (int n = 0; n < IM_FONTATLAS_ROUND_CORNERS_COUNT; n++)
+    {
+        bool stroked;
+        const float radius_outer = ImFontAtlasGetRoundCornerRadius(n, &stroked);
+        const float radius_inner = stroked ? radius_outer - 1.0f : 0.0f;
+        const int size = (int)ImCeil(radius_outer);
+        ImFontAtlasCustomRect* r = atlas->GetCustomRectByIndex(atlas->PackIdRoundCorners + n);
+        IM_ASSERT(r->IsPacked() && r->Width == size + 2 && r->Height == size + 2);
+        for (int y = 0; y < r->Height; y++)
+        {
+            unsigned char* write_ptr = &atlas->TexPixelsAlpha8[r->X + ((r->Y + y) * atlas->TexWidth)];
+            const float dy = ImMax(radius_outer - ((float)y - 0.5f), 0.0f);
+            for (int x = 0; x < r->Width; x++)
+            {
+                const float dx = ImMax(radius_outer - ((float)x - 0.5f), 0.0f);
+                const float d = ImSqrt(dx * dx + dy * dy);
+                float alpha = ImSaturate(radius_outer - d + 0.5f);
+                if (radius_inner > 0.0f)
+                    alpha -= ImSaturate(radius_inner - d + 0.5f);
+                write_ptr[x] = (unsigned char)IM_F32_TO_INT8_SAT(alpha);
+            }
+        }
+
+        // Calculate UVs for this corner: outer corner and inner corner of the shape, excluding the border
+        const ImVec2 uv0 = ImVec2((float)(r->X + 1), (float)(r->Y + 1)) * atlas->TexUvScale;
+        const ImVec2 uv1 = ImVec2((float)(r->X + 1 + size), (float)(r->Y + 1 + size)) * atlas->TexUvScale;
+        if (stroked)
+            atlas->TexUvRoundCornersStroked[(int)(radius_outer * 2.0f)] = ImVec4(uv0.x, uv0.y, uv1.x, uv1.y);
+        else
+            atlas->TexUvRoundCornersFilled[(int)radius_outer] = ImVec4(uv0.x, uv0.y, uv1.x, uv1.y);
+    }
+}
+
 // Note: this is called / shared by both the stb_truetype and the FreeType builder
 void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 {
@@ -2454,6 +4359,21 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
         if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
             atlas->PackIdLines = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
     }
+
+    // Register texture regions for round corners, contiguous from PackIdRoundCorners
+    // The +2 here is to give space for a 1 pixel border on each side
+    if (atlas->PackIdRoundCorners < 0)
+    {
+        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+            for (int n = 0; n < IM_FONTATLAS_ROUND_CORNERS_COUNT; n++)
+            {
+                bool stroked;
+                const int size = (int)ImCeil(ImFontAtlasGetRoundCornerRadius(n, &stroked)) + 2;
+                const int id = atlas->AddCustomRectRegular(size, size);
+                if (n == 0)
+                    atlas->PackIdRoundCorners = id;
+            }
+    }
 }
 
 // This is called/shared by both the stb_truetype and the FreeType builder.
@@ -2463,6 +4383,7 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     IM_ASSERT(atlas->TexPixelsAlpha8 != NULL);
     ImFontAtlasBuildRenderDefaultTexData(atlas);
     ImFontAtlasBuildRenderLinesTexData(atlas);
+    ImFontAtlasBuildRenderRoundCornersTexData(atlas);
 
     // Register custom rectangle glyphs
     for (int i = 0; i < atlas->CustomRects.Size; i++)
@@ -3333,10 +5254,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 {
                     idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                     idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    vtx_write[0].pos = IM_DRAWLIST_EMIT_POS(draw_list, ImVec2(x1, y1)); vtx_write[0].col = col; vtx_write[0].uv = ImVec2(u1, v1);
+                    vtx_write[1].pos = IM_DRAWLIST_EMIT_POS(draw_list, ImVec2(x2, y1)); vtx_write[1].col = col; vtx_write[1].uv = ImVec2(u2, v1);
+                    vtx_write[2].pos = IM_DRAWLIST_EMIT_POS(draw_list, ImVec2(x2, y2)); vtx_write[2].col = col; vtx_write[2].uv = ImVec2(u2, v2);
+                    vtx_write[3].pos = IM_DRAWLIST_EMIT_POS(draw_list, ImVec2(x1, y2)); vtx_write[3].col = col; vtx_write[3].uv = ImVec2(u1, v2);
                     vtx_write += 4;
                     vtx_current_idx += 4;
                     idx_write += 6;
@@ -20,6 +20,9 @@ Index of this file:
 // [SECTION] Widgets support: flags, enums, data structures
 // [SECTION] Columns support
 // [SECTION] Settings support
+// [SECTION] Profiler support
+// [SECTION] Allocation tracking support
+// [SECTION] Input recording support
 // [SECTION] Multi-select support
 // [SECTION] Docking support
 // [SECTION] Viewport support
@@ -95,13 +98,19 @@ struct ImGuiColumns;                // Storage data for a columns set
 struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
+struct ImGuiInputRecorder;          // Recording of the ImGuiIO input stream (see DebugStartInputRecording())
+struct ImGuiInputRecordState;       // Inputs of the last recorded or replayed frame
+struct ImGuiInputReplay;            // Replay of a recording made with ImGuiInputRecorder
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiLastItemDataBackup;     // Backup and restore IsItemHovered() internal data
+struct ImGuiMemStats;               // Heap allocation counters for one frame
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
 struct ImGuiNavMoveResult;          // Result of a gamepad/keyboard directional navigation move query result
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiProfilerFrame;          // Storage for the timings of one frame (when IMGUI_DEBUG_PROFILER is enabled)
+struct ImGuiProfilerTraceEvent;     // A timed phase recorded for trace export (when IMGUI_DEBUG_PROFILER is enabled)
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
@@ -112,6 +121,7 @@ struct ImGuiWindowSettings;         // Storage for a window .ini settings (we ke
 
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
 typedef int ImGuiLayoutType;            // -> enum ImGuiLayoutType_         // Enum: Horizontal or vertical
+typedef int ImGuiMemTag;                // -> enum ImGuiMemTag_             // Enum: Call-site category of a heap allocation
 typedef int ImGuiButtonFlags;           // -> enum ImGuiButtonFlags_        // Flags: for ButtonEx(), ButtonBehavior()
 typedef int ImGuiColumnsFlags;          // -> enum ImGuiColumnsFlags_       // Flags: BeginColumns()
 typedef int ImGuiItemFlags;             // -> enum ImGuiItemFlags_          // Flags: for PushItemFlag()
@@ -209,6 +219,15 @@ namespace ImStb
 #define IMGUI_CDECL
 #endif
 
+// Thread-local storage, used to tell apart the thread running NewFrame() from other threads (see MemAlloc()). Left undefined when unsupported.
+#ifndef IM_THREAD_LOCAL
+#if defined(_MSC_VER)
+#define IM_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define IM_THREAD_LOCAL __thread
+#endif
+#endif
+
 // Debug Tools
 // Use 'Metrics->Tools->Item Picker' to break into the call-stack of a specific item.
 #ifndef IM_DEBUG_BREAK
@@ -385,6 +404,7 @@ static inline ImVec2 ImMul(const ImVec2& lhs, const ImVec2& rhs)
 
 // Helpers: Geometry
 IMGUI_API ImVec2     ImBezierCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, float t);                                         // Cubic Bezier
+IMGUI_API ImVec2     ImBezierQuadraticCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, float t);                                                  // Quadratic Bezier
 IMGUI_API ImVec2     ImBezierClosestPoint(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& p, int num_segments);       // For curves with explicit number of segments
 IMGUI_API ImVec2     ImBezierClosestPointCasteljau(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& p, float tess_tol);// For auto-tessellated curves you can use tess_tol = style.CurveTessellationTol
 IMGUI_API ImVec2     ImLineClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& p);
@@ -539,6 +559,47 @@ struct IMGUI_API ImChunkStream
 #define IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER             1
 #endif
 
+// ImDrawList: Largest segment count of the unit circles precomputed in ImDrawListSharedData::CircleVtx[] for PathArcTo(), AddCircle() etc. (~16 KB with 64).
+// Arcs with more segments, or not aligned on a precomputed circle, rotate their first point incrementally.
+#ifndef IM_DRAWLIST_CIRCLE_VTX_SEGMENT_MAX
+#define IM_DRAWLIST_CIRCLE_VTX_SEGMENT_MAX                      64
+#endif
+#define IM_DRAWLIST_CIRCLE_VTX_OFFSET(_N)                       ((_N) * ((_N) - 1) / 2 - 3)     // Offset of the unit circle with _N segments in ImDrawListSharedData::CircleVtx[] (3 <= _N <= IM_DRAWLIST_CIRCLE_VTX_SEGMENT_MAX)
+
+// ImDrawList: Longest miter of ImDrawLineFlags_JoinMiter joins, as a multiple of the line thickness, past which joins are beveled (same as SVG's default stroke-miterlimit).
+#ifndef IM_DRAWLIST_MITER_LIMIT
+#define IM_DRAWLIST_MITER_LIMIT                                 4.0f
+#endif
+
+// ImDrawList: Number of flattened Bezier curves kept by ImDrawListBezierCache (power of two, 0 to disable), and total number of points kept before it is flushed.
+#ifndef IM_DRAWLIST_BEZIER_CACHE_SIZE
+#define IM_DRAWLIST_BEZIER_CACHE_SIZE                           4096
+#endif
+#ifndef IM_DRAWLIST_BEZIER_CACHE_POINTS_MAX
+#define IM_DRAWLIST_BEZIER_CACHE_POINTS_MAX                     (64 * 1024)
+#endif
+
+// Cache of flattened Bezier curves used by PathBezierCurveTo()/PathBezierQuadraticCurveTo(), keyed on control points relative to the first one
+// and on tessellation parameters, so identical curves are only flattened once even when translated (e.g. links of a scrolled node graph).
+// Direct-mapped: a curve replaces any other curve hashing to the same entry. Points are appended to a single buffer which is flushed when full.
+struct ImDrawListBezierCacheEntry
+{
+    ImVec2          Ctrl[3];                    // Control points relative to first point (Ctrl[2] is unused for quadratic curves)
+    float           TessTol;                    // Tessellation tolerance, or 0.0f when using NumSegments
+    int             NumSegments;
+    int             Order;                      // 2: quadratic, 3: cubic, 0: unused entry
+    int             PointsOffset;               // Offset of flattened points in ImDrawListBezierCache::Points, relative to first point and excluding it
+    int             PointsCount;
+};
+
+struct IMGUI_API ImDrawListBezierCache
+{
+    ImVector<ImDrawListBezierCacheEntry> Entries;  // IM_DRAWLIST_BEZIER_CACHE_SIZE entries, allocated on first use
+    ImVector<ImVec2>                     Points;
+
+    void            Flush()                     { memset(Entries.Data, 0, (size_t)Entries.size_in_bytes()); Points.resize(0); }
+};
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -552,14 +613,26 @@ struct IMGUI_API ImDrawListSharedData
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
 
     // [Internal] Lookup tables
-    ImVec2          ArcFastVtx[12 * IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER];  // FIXME: Bake rounded corners fill/borders in atlas
+    ImVec2          ArcFastVtx[12 * IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER];  // FIXME: Bake rounded corners borders thicker than 1.0f in atlas
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius (array index + 1) before we calculate it dynamically (to avoid calculation overhead)
+    ImVec2          CircleVtx[IM_DRAWLIST_CIRCLE_VTX_OFFSET(IM_DRAWLIST_CIRCLE_VTX_SEGMENT_MAX + 1)]; // Unit circles for 3 to IM_DRAWLIST_CIRCLE_VTX_SEGMENT_MAX segments, starting at angle 0
     const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas
+    const ImVec4*   TexUvRoundCornersFilled;    // UV of anti-aliased filled round corners in the atlas
+    const ImVec4*   TexUvRoundCornersStroked;   // UV of anti-aliased stroked round corners in the atlas
+    ImDrawListBezierCache* BezierCache;         // Flattened Bezier curves, optional (makes PathBezierCurveTo() unsafe to call from multiple threads on draw lists sharing this data)
 
     ImDrawListSharedData();
     void SetCircleSegmentMaxError(float max_error);
 };
 
+// ImDrawData: Size in pixels of the screen tiles compared when io.ConfigDrawDataDamageRects is set, and number of output rectangles above which they are merged into one.
+#ifndef IM_DRAWDATA_DAMAGE_TILE_SIZE
+#define IM_DRAWDATA_DAMAGE_TILE_SIZE                            32
+#endif
+#ifndef IM_DRAWDATA_DAMAGE_RECTS_MAX
+#define IM_DRAWDATA_DAMAGE_RECTS_MAX                            64
+#endif
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>   Layers[2];           // Global layers for: regular, tooltip
@@ -920,7 +993,8 @@ enum ImGuiNextWindowDataFlags_
     ImGuiNextWindowDataFlags_HasSizeConstraint  = 1 << 4,
     ImGuiNextWindowDataFlags_HasFocus           = 1 << 5,
     ImGuiNextWindowDataFlags_HasBgAlpha         = 1 << 6,
-    ImGuiNextWindowDataFlags_HasScroll          = 1 << 7
+    ImGuiNextWindowDataFlags_HasScroll          = 1 << 7,
+    ImGuiNextWindowDataFlags_HasContentToken    = 1 << 8
 };
 
 // Storage for SetNexWindow** functions
@@ -940,6 +1014,7 @@ struct ImGuiNextWindowData
     ImGuiSizeCallback           SizeCallback;
     void*                       SizeCallbackUserData;
     float                       BgAlphaVal;             // Override background alpha
+    ImGuiID                     ContentTokenVal;        // Set by SetNextWindowContentToken(), see ImGuiWindowFlags_CacheContents
     ImVec2                      MenuBarOffsetMinVal;    // *Always on* This is not exposed publicly, so we don't clear it.
 
     ImGuiNextWindowData()       { memset(this, 0, sizeof(*this)); }
@@ -1098,6 +1173,159 @@ struct ImGuiSettingsHandler
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Profiler support
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_DEBUG_PROFILER
+
+#define IMGUI_PROFILER_HISTORY_SIZE     120     // Number of frames kept in g.ProfilerFrames[]
+
+// Timings for one frame, all in seconds. PhaseStart[] are relative to the start of NewFrame().
+// When a phase runs multiple times in a frame (e.g. Begin()), PhaseStart[] is the first occurrence and PhaseTime[] is the accumulated total.
+struct ImGuiProfilerFrame
+{
+    int         FrameCount;                             // Value of g.FrameCount for this frame
+    ImU64       StartTicks;                             // Timer value at the start of NewFrame()
+    float       PhaseStart[ImGuiProfilerPhase_COUNT];   // -1.0f if the phase didn't run this frame
+    float       PhaseTime[ImGuiProfilerPhase_COUNT];
+
+    ImGuiProfilerFrame()    { Clear(0, 0); }
+    void Clear(int frame_count, ImU64 start_ticks) { FrameCount = frame_count; StartTicks = start_ticks; for (int n = 0; n < ImGuiProfilerPhase_COUNT; n++) { PhaseStart[n] = -1.0f; PhaseTime[n] = 0.0f; } }
+};
+
+// A completed phase recorded while a trace capture is active, see ProfilerTraceStart()
+// Window spans cover the whole Begin()..End() block of a window, including its contents and child windows.
+struct ImGuiProfilerTraceEvent
+{
+    ImGuiProfilerPhase  Phase;                          // -1 for a window span
+    const char*         WindowName;                     // Window of Begin()/End() phases and window spans, NULL otherwise
+    ImU64               StartTicks;
+    ImU64               EndTicks;
+};
+
+// Time a scope, see IMGUI_PROFILER_SCOPE()
+struct IMGUI_API ImGuiProfilerScope
+{
+    ImGuiProfilerPhase  Phase;
+    ImU64               StartTicks;
+
+    ImGuiProfilerScope(ImGuiProfilerPhase phase);
+    ~ImGuiProfilerScope();
+    void NextPhase(ImGuiProfilerPhase phase);           // End the current phase and start another one, for sequential steps within a same function
+};
+#define IMGUI_PROFILER_SCOPE(_PHASE)    IMGUI_PROFILER_SCOPE_(_PHASE, __LINE__)
+#define IMGUI_PROFILER_SCOPE_(_PHASE,_LINE)     IMGUI_PROFILER_SCOPE__(_PHASE, _LINE)
+#define IMGUI_PROFILER_SCOPE__(_PHASE,_LINE)    ImGuiProfilerScope im_profiler_scope_##_LINE(_PHASE) // Unique name so scopes can be nested within a function
+#define IMGUI_PROFILER_SCOPE_NAMED(_NAME,_PHASE)    ImGuiProfilerScope _NAME(_PHASE)
+#define IMGUI_PROFILER_SCOPE_NEXT(_NAME,_PHASE)     _NAME.NextPhase(_PHASE)
+
+#else
+#define IMGUI_PROFILER_SCOPE(_PHASE)    do { } while (0)
+#define IMGUI_PROFILER_SCOPE_NAMED(_NAME,_PHASE)    do { } while (0)
+#define IMGUI_PROFILER_SCOPE_NEXT(_NAME,_PHASE)     do { } while (0)
+#endif // #ifdef IMGUI_DEBUG_PROFILER
+
+//-----------------------------------------------------------------------------
+// [SECTION] Allocation tracking support
+//-----------------------------------------------------------------------------
+
+// Call-site categories for heap allocations (only recorded when IMGUI_DEBUG_ALLOCATIONS is enabled)
+enum ImGuiMemTag_
+{
+    ImGuiMemTag_Other = 0,      // Untagged call-site
+    ImGuiMemTag_DrawList,       // ImDrawList vertex/index/command buffers, channels
+    ImGuiMemTag_Storage,        // ImGuiStorage insertion
+    ImGuiMemTag_TextBuffer,     // ImGuiTextBuffer growth
+    ImGuiMemTag_InputText,      // InputText() state
+    ImGuiMemTag_Settings,       // .ini settings loading/saving
+    ImGuiMemTag_COUNT
+};
+
+// Heap allocations made through MemAlloc()/MemFree() over one frame (from NewFrame() to the next NewFrame())
+struct ImGuiMemStats
+{
+    int         AllocCount;
+    int         FreeCount;
+    size_t      AllocBytes;
+#ifdef IMGUI_DEBUG_ALLOCATIONS
+    int         TagAllocCount[ImGuiMemTag_COUNT];
+    size_t      TagAllocBytes[ImGuiMemTag_COUNT];
+#endif
+
+    ImGuiMemStats()     { Clear(); }
+    void Clear()        { memset(this, 0, sizeof(*this)); }
+};
+
+#ifdef IMGUI_DEBUG_ALLOCATIONS
+// Attribute allocations made within a scope to a call-site category, see IMGUI_MEM_TAG_SCOPE(). Scopes can be nested, the inner-most wins.
+struct IMGUI_API ImGuiMemTagScope
+{
+    ImGuiMemTag         BackupTag;
+
+    ImGuiMemTagScope(ImGuiMemTag tag);
+    ~ImGuiMemTagScope();
+};
+#define IMGUI_MEM_TAG_SCOPE(_TAG)       ImGuiMemTagScope im_mem_tag_scope(_TAG)
+// Grow an ImVector ahead of a push_back()/resize() to _SIZE elements (same capacity policy), attributing the allocation to _TAG.
+// Hot paths use this instead of IMGUI_MEM_TAG_SCOPE() so the tag is only set when the vector actually grows.
+#define IMGUI_MEM_TAG_GROW(_TAG,_VEC,_SIZE)     do { if ((_SIZE) > (_VEC).Capacity) { IMGUI_MEM_TAG_SCOPE(_TAG); (_VEC).reserve((_VEC)._grow_capacity(_SIZE)); } } while (0)
+#else
+#define IMGUI_MEM_TAG_SCOPE(_TAG)       do { } while (0)
+#define IMGUI_MEM_TAG_GROW(_TAG,_VEC,_SIZE)     do { } while (0)
+#endif // #ifdef IMGUI_DEBUG_ALLOCATIONS
+
+//-----------------------------------------------------------------------------
+// [SECTION] Input recording support
+//-----------------------------------------------------------------------------
+
+// Inputs of the last recorded or replayed frame. Each frame is stored as the list of fields which changed from this state.
+struct ImGuiInputRecordState
+{
+    float       DeltaTime;
+    ImVec2      DisplaySize;
+    ImVec2      MousePos;
+    bool        MouseDown[5];
+    float       MouseWheel;
+    float       MouseWheelH;
+    bool        KeyCtrl, KeyShift, KeyAlt, KeySuper;
+    bool        KeysDown[512];
+    float       NavInputs[ImGuiNavInput_COUNT];
+
+    ImGuiInputRecordState() { memset(this, 0, sizeof(*this)); }
+};
+
+// Record the ImGuiIO input stream into a compact binary buffer (native endianness), see DebugStartInputRecording().
+// Each frame is a 16-bit mask of changed fields followed by their values, so a frame without any input change takes 2 bytes.
+struct IMGUI_API ImGuiInputRecorder
+{
+    ImVector<unsigned char> Data;
+    ImGuiInputRecordState   State;
+    int                     FramesCount;
+
+    ImGuiInputRecorder()    { FramesCount = 0; }
+    void    Clear()         { Data.clear(); State = ImGuiInputRecordState(); FramesCount = 0; }
+    void    RecordFrame(const ImGuiIO& io);             // Called by NewFrame() while recording. Can also be called manually right before NewFrame().
+    bool    SaveToFile(const char* filename) const;
+};
+
+// Replay a recording made with ImGuiInputRecorder, typically against a headless context to compare timings and DebugHashDrawData() across runs.
+// The application must submit the same UI as during the recording for the replay to be meaningful.
+struct IMGUI_API ImGuiInputReplay
+{
+    ImVector<unsigned char> Data;
+    ImGuiInputRecordState   State;
+    int                     ReadOffset;
+    int                     FramesCount;                // Number of frames in the recording
+    int                     FrameIdx;                   // Index of the next frame to replay
+
+    ImGuiInputReplay()      { ReadOffset = FramesCount = FrameIdx = 0; }
+    void    Clear()         { Data.clear(); State = ImGuiInputRecordState(); ReadOffset = FramesCount = FrameIdx = 0; }
+    bool    LoadFromMemory(const void* data, size_t data_size); // Return false if the data is not a valid recording
+    bool    LoadFromFile(const char* filename);
+    bool    ApplyNextFrame(ImGuiIO* io);                // Write the inputs of the next frame into io, call right before NewFrame(). Return false once all frames have been replayed.
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiContext (main imgui context)
 //-----------------------------------------------------------------------------
@@ -1112,6 +1340,7 @@ struct ImGuiContext
     float                   FontSize;                           // (Shortcut) == FontBaseSize * g.CurrentWindow->FontWindowScale == window->FontSize(). Text height for current window.
     float                   FontBaseSize;                       // (Shortcut) == IO.FontGlobalScale * Font->Scale * Font->FontSize. Base text height.
     ImDrawListSharedData    DrawListSharedData;
+    ImDrawListBezierCache   DrawListBezierCache;                // Referenced by DrawListSharedData
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -1242,6 +1471,11 @@ struct ImGuiContext
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
     ImDrawList              BackgroundDrawList;                 // First draw list to be rendered.
     ImDrawList              ForegroundDrawList;                 // Last draw list to be rendered. This is where we the render software mouse cursor (if io.MouseDrawCursor is set) and most debug overlays.
+    ImDrawList              DrawDataFlattenedList;              // All draw lists merged into one, output instead of them when io.ConfigDrawDataFlatten is set.
+    ImVector<ImU32>         DrawDataDamageTiles;                // Hash of the triangles overlapping each screen tile of DrawData, in rendering order, when io.ConfigDrawDataDamageRects is set.
+    ImVector<ImU32>         DrawDataDamageTilesPrev;            // Same for the previous frame
+    ImVector<ImVec4>        DrawDataDamageRects;                // Storage for DrawData.DamageRects
+    ImVec4                  DrawDataDamageDisplayRect;          // Display rectangle covered by DrawDataDamageTiles
     ImGuiMouseCursor        MouseCursor;
 
     // Drag and Drop
@@ -1315,6 +1549,22 @@ struct ImGuiContext
     // Debug Tools
     bool                    DebugItemPickerActive;              // Item picker is active (started with DebugStartItemPicker())
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this id
+    int                     DebugAllocAssertAfterFrame;         // When >= 0, assert on any heap allocation made after this frame, to verify that a steady UI doesn't allocate (see DebugStartAllocationAssert())
+    ImGuiMemStats           MemStatsThisFrame;                  // Heap allocations made since the last NewFrame()
+    ImGuiMemStats           MemStatsLastFrame;                  // Heap allocations made during the previous frame
+    ImGuiMemTag             MemTagCurrent;                      // Call-site category of allocations (only set when IMGUI_DEBUG_ALLOCATIONS is enabled)
+    const void*             MemThreadId;                        // Thread which last called CreateContext()/NewFrame(). Allocations made on other threads are not counted nor tagged.
+    ImGuiInputRecorder*     DebugInputRecorder;                 // When != NULL, io inputs are recorded at the beginning of every NewFrame() (see DebugStartInputRecording())
+#ifdef IMGUI_DEBUG_PROFILER
+    ImGuiProfilerFrame      ProfilerFrames[IMGUI_PROFILER_HISTORY_SIZE]; // Rolling history of frame timings, ProfilerFrames[ProfilerFrameIdx] is the current frame
+    int                     ProfilerFrameIdx;
+    int                     ProfilerPhaseDepth[ImGuiProfilerPhase_COUNT]; // Nesting depth of each phase, only the outer-most scope is recorded
+    double                  ProfilerPhaseTotalTime[ImGuiProfilerPhase_COUNT]; // Accumulated time of each phase since context creation, in seconds (also recorded outside of frames, e.g. font atlas builds)
+    int                     ProfilerPhaseTotalCount[ImGuiProfilerPhase_COUNT];
+    ImVector<ImU64>         ProfilerWindowStartTicks;           // Begin() start time for each entry of CurrentWindowStack, to measure time spent between Begin() and End()
+    bool                    ProfilerTraceActive;                // Record every outer-most phase into ProfilerTraceEvents[], see ProfilerTraceStart()
+    ImVector<ImGuiProfilerTraceEvent> ProfilerTraceEvents;
+#endif
 
     // Misc
     float                   FramerateSecPerFrame[120];          // Calculate estimate of framerate for user over the last 2 seconds.
@@ -1325,7 +1575,7 @@ struct ImGuiContext
     int                     WantTextInputNextFrame;
     char                    TempBuffer[1024 * 3 + 1];           // Temporary text buffer
 
-    ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData)
+    ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData), DrawDataFlattenedList(&DrawListSharedData)
     {
         Initialized = false;
         FontAtlasOwnedByContext = shared_font_atlas ? false : true;
@@ -1413,6 +1663,8 @@ struct ImGuiContext
         DimBgRatio = 0.0f;
         BackgroundDrawList._OwnerName = "##Background"; // Give it a name for debugging
         ForegroundDrawList._OwnerName = "##Foreground"; // Give it a name for debugging
+        DrawDataFlattenedList._OwnerName = "##Flattened"; // Give it a name for debugging
+        DrawDataDamageDisplayRect = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
         MouseCursor = ImGuiMouseCursor_Arrow;
 
         DragDropActive = DragDropWithinSource = DragDropWithinTarget = false;
@@ -1458,6 +1710,17 @@ struct ImGuiContext
 
         DebugItemPickerActive = false;
         DebugItemPickerBreakId = 0;
+        DebugAllocAssertAfterFrame = -1;
+        MemTagCurrent = ImGuiMemTag_Other;
+        MemThreadId = NULL;
+        DebugInputRecorder = NULL;
+#ifdef IMGUI_DEBUG_PROFILER
+        ProfilerFrameIdx = 0;
+        memset(ProfilerPhaseDepth, 0, sizeof(ProfilerPhaseDepth));
+        memset(ProfilerPhaseTotalTime, 0, sizeof(ProfilerPhaseTotalTime));
+        memset(ProfilerPhaseTotalCount, 0, sizeof(ProfilerPhaseTotalCount));
+        ProfilerTraceActive = false;
+#endif
 
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = 0;
@@ -1598,6 +1861,7 @@ struct IMGUI_API ImGuiWindow
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
     bool                    HasCloseButton;                     // Set when the window has a close button (p_open != NULL)
+    bool                    ContentsReused;                     // Set when last frame draw list and layout are reused instead of submitting contents again (ImGuiWindowFlags_CacheContents)
     signed char             ResizeBorderHeld;                   // Current border being held for resize (-1: none, otherwise 0-3)
     short                   BeginCount;                         // Number of Begin() during the current frame (generally 0 or 1, 1+ if appending via multiple Begin/End pairs)
     short                   BeginOrderWithinParent;             // Order within immediate parent window, if we are a child window. Otherwise 0.
@@ -1629,6 +1893,7 @@ struct IMGUI_API ImGuiWindow
     ImRect                  ContentRegionRect;                  // FIXME: This is currently confusing/misleading. It is essentially WorkRect but not handling of scrolling. We currently rely on it as right/bottom aligned sizing operation need some size to rely on.
     ImVec2ih                HitTestHoleSize;                    // Define an optional rectangular hole where mouse will pass-through the window.
     ImVec2ih                HitTestHoleOffset;
+    ImGuiID                 ContentsHash;                       // Hash of the state affecting the output of a ImGuiWindowFlags_CacheContents window besides its contents, when it was idle. 0 when contents can't be reused.
 
     int                     LastFrameActive;                    // Last frame number the window was Active.
     float                   LastTimeActive;                     // Last timestamp the window was Active (using float as we don't need high precision there)
@@ -1653,6 +1918,13 @@ struct IMGUI_API ImGuiWindow
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
 
+#ifdef IMGUI_DEBUG_PROFILER
+    float                   ProfilerTimeBegin;                  // Time spent in Begin() for this window during the previous frame, in seconds
+    float                   ProfilerTimeTotal;                  // Time spent from the start of Begin() to the end of End() during the previous frame (includes contents submission and child windows)
+    float                   ProfilerTimeBeginAccum;             // Accumulators for the current frame
+    float                   ProfilerTimeTotalAccum;
+#endif
+
 public:
     ImGuiWindow(ImGuiContext* context, const char* name);
     ~ImGuiWindow();
@@ -2037,6 +2309,24 @@ namespace ImGui
     // Debug Tools
     inline void             DebugDrawItemRect(ImU32 col = IM_COL32(255,0,0,255))    { ImGuiContext& g = *GImGui; ImGuiWindow* window = g.CurrentWindow; GetForegroundDrawList(window)->AddRect(window->DC.LastItemRect.Min, window->DC.LastItemRect.Max, col); }
     inline void             DebugStartItemPicker()                                  { ImGuiContext& g = *GImGui; g.DebugItemPickerActive = true; }
+    inline void             DebugStartAllocationAssert(int warmup_frames)           { ImGuiContext& g = *GImGui; g.DebugAllocAssertAfterFrame = g.FrameCount + warmup_frames; }
+    inline void             DebugStartInputRecording(ImGuiInputRecorder* recorder)  { ImGuiContext& g = *GImGui; g.DebugInputRecorder = recorder; }
+    inline void             DebugStopInputRecording()                               { ImGuiContext& g = *GImGui; g.DebugInputRecorder = NULL; }
+    IMGUI_API ImU32         DebugHashDrawData(const ImDrawData* draw_data);         // Hash vertices, indices and draw commands, to compare the output of two runs
+
+    // Profiler (when IMGUI_DEBUG_PROFILER is enabled)
+#ifdef IMGUI_DEBUG_PROFILER
+    IMGUI_API ImU64         ProfilerGetTicks();
+    IMGUI_API float         ProfilerTicksToSeconds(ImU64 ticks);
+    IMGUI_API ImU64         ProfilerPhaseBegin(ImGuiProfilerPhase phase);                   // Return start ticks to pass to ProfilerPhaseEnd()
+    IMGUI_API float         ProfilerPhaseEnd(ImGuiProfilerPhase phase, ImU64 start_ticks, const char* window_name = NULL); // Return elapsed time in seconds
+    IMGUI_API ImGuiProfilerFrame* ProfilerGetFrame(int frames_ago);
+    IMGUI_API const char*   ProfilerGetPhaseName(ImGuiProfilerPhase phase);
+    IMGUI_API void          ProfilerTraceStart();                                           // Clear and start recording trace events (in the current context)
+    IMGUI_API void          ProfilerTraceStop();
+    IMGUI_API void          ProfilerTraceExport(ImGuiTextBuffer* buf);                      // Append recorded events as comma-separated Chrome trace-event JSON objects, to merge into an existing "traceEvents" array
+    IMGUI_API bool          ProfilerTraceSaveToFile(const char* filename);                  // Write recorded events as a complete JSON file for chrome://tracing or Perfetto
+#endif
 
 } // namespace ImGui
 
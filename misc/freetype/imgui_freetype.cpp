@@ -323,6 +323,8 @@ struct ImFontBuildDstDataFT
 bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, unsigned int extra_flags)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
+    IMGUI_PROFILER_SCOPE(ImGuiProfilerPhase_FontAtlasBuild);
+    IMGUI_PROFILER_SCOPE_NAMED(profiler_step, ImGuiProfilerPhase_FontAtlasGlyphLookup);
 
     ImFontAtlasBuildInit(atlas);
 
@@ -443,6 +445,8 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
 
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
     // 8. Render/rasterize font characters into the texture
+    // (FreeType only gives us accurate sizes after rendering, so rasterization happens before packing)
+    IMGUI_PROFILER_SCOPE_NEXT(profiler_step, ImGuiProfilerPhase_FontAtlasRasterize);
     int total_surface = 0;
     int buf_rects_out_n = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -505,6 +509,7 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
         atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
 
     // 5. Start packing
+    IMGUI_PROFILER_SCOPE_NEXT(profiler_step, ImGuiProfilerPhase_FontAtlasPackRects);
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
     const int TEX_HEIGHT_MAX = 1024 * 32;
     const int num_nodes_for_packing_algorithm = atlas->TexWidth - atlas->TexGlyphPadding;
@@ -531,6 +536,7 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
     }
 
     // 7. Allocate texture
+    IMGUI_PROFILER_SCOPE_NEXT(profiler_step, ImGuiProfilerPhase_FontAtlasFinish);
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);